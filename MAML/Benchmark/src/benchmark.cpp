@@ -0,0 +1,102 @@
+#include "signal\fft.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+using namespace maml;
+
+namespace {
+
+	using Clock = std::chrono::steady_clock;
+
+	[[nodiscard]]
+	F64 ElapsedSeconds(Clock::time_point start) noexcept {
+		return std::chrono::duration< F64 >(Clock::now() - start).count();
+	}
+
+	// Runs the given action repeatedly for at least the given duration and
+	// returns the average time (in seconds) per run.
+	template< typename ActionT >
+	[[nodiscard]]
+	F64 Measure(ActionT&& action, F64 min_duration = 0.2) {
+		action(); // warm-up
+
+		std::size_t nb_runs = 0u;
+		const auto start = Clock::now();
+		F64 elapsed = 0.0;
+		do {
+			action();
+			++nb_runs;
+			elapsed = ElapsedSeconds(start);
+		}
+		while (elapsed < min_duration);
+
+		return elapsed / static_cast< F64 >(nb_runs);
+	}
+
+	void NaiveDFT(std::span< const C32 > input, std::span< C32 > output) noexcept {
+		const std::size_t n = input.size();
+		for (std::size_t k = 0u; k < n; ++k) {
+			C32 sum;
+			for (std::size_t j = 0u; j < n; ++j) {
+				const F32 angle = -2.0f * std::numbers::pi_v< F32 >
+					            * static_cast< F32 >((k * j) % n) / static_cast< F32 >(n);
+				sum += input[j] * C32(std::cos(angle), std::sin(angle));
+			}
+			output[k] = sum;
+		}
+	}
+
+	void Benchmark(std::size_t size, SIMDLevel level) {
+		SetSIMDLevel(level);
+
+		std::mt19937 generator(static_cast< unsigned >(size));
+		std::uniform_real_distribution< F32 > distribution(-1.0f, 1.0f);
+		std::vector< C32 > input(size);
+		std::vector< C32 > output(size);
+		for (auto& v : input) {
+			v = { distribution(generator), distribution(generator) };
+		}
+
+		const auto start = Clock::now();
+		FFTPlan< F32 > plan(size);
+		const F64 setup_time = ElapsedSeconds(start);
+
+		const F64 fft_time = Measure([&]() {
+			plan.Forward(input, output);
+		});
+
+		// 5 n log2(n) flops for a radix-2 FFT of size n.
+		const F64 flops = 5.0 * static_cast< F64 >(size) * std::log2(static_cast< F64 >(size));
+
+		std::printf("%8zu %8u %12.3f %12.3f %10.3f", size, static_cast< unsigned >(level),
+					setup_time * 1e6, fft_time * 1e6, flops / fft_time * 1e-9);
+
+		// The naive DFT is O(n^2).
+		if (size <= 8192u) {
+			const F64 dft_time = Measure([&]() {
+				NaiveDFT(input, output);
+			}, 0.0);
+			std::printf(" %14.3f %10.1fx", dft_time * 1e6, dft_time / fft_time);
+		}
+
+		std::printf("\n");
+	}
+}
+
+int main() {
+	const SIMDLevel level = GetSIMDLevel();
+
+	std::printf("%8s %8s %12s %12s %10s %14s %11s\n",
+				"size", "level", "setup [us]", "fft [us]", "GFLOP/s", "dft [us]", "speed-up");
+
+	for (std::size_t size = 64u; size <= (1u << 20u); size *= 2u) {
+		Benchmark(size, SIMDLevel::None);
+		if (SIMDLevel::None != level) {
+			Benchmark(size, level);
+		}
+	}
+
+	return 0;
+}
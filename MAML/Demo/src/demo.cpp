@@ -1,20 +1,480 @@
 #include "algebra\complex.hpp"
 #include "algebra\dual.hpp"
+#include "algebra\gradient_dual.hpp"
+#include "algebra\hyper_dual.hpp"
 #include "algebra\hyperbolic.hpp"
+#include "algebra\quaternion.hpp"
+#include "approximation\chebyshev.hpp"
+#include "approximation\fast_math.hpp"
+#include "approximation\lut.hpp"
+#include "approximation\polynomial.hpp"
+#include "autodiff\tape.hpp"
+#include "collection\soa.hpp"
+#include "signal\fft.hpp"
+#include "signal\oscillator.hpp"
+#include "simd\algebra.hpp"
+#include "simd\batch.hpp"
+#include "simd\integer_vector.hpp"
+#include "simd\math.hpp"
+#include "simd\matrix.hpp"
+#include "simd\quaternion.hpp"
+#include "simd\swizzle.hpp"
 #include "simd\vector.hpp"
 
 #include "constexpr\math.hpp"
 
+#include <cmath>
 #include <iostream>
+#include <numbers>
+#include <vector>
 
 using namespace maml;
 
+//-----------------------------------------------------------------------------
+// Checks
+//-----------------------------------------------------------------------------
+namespace {
+
+	int g_nb_failures = 0;
+
+	void Check(bool condition, const char* description) {
+		if (!condition) {
+			std::cout << "Failed: " << description << std::endl;
+			++g_nb_failures;
+		}
+	}
+
+	[[nodiscard]]
+	bool Near(F64 x, F64 y, F64 tolerance) noexcept {
+		return std::abs(x - y) <= tolerance;
+	}
+}
+
+#define MAML_CHECK(condition) Check(condition, #condition)
+
+namespace {
+
+	void CheckVectors() {
+		#ifdef MAML_HAS_AVX2_VECTORS
+		if (SIMDLevel::AVX2 <= GetSupportedSIMDLevel()) {
+			const F32x8S a(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f);
+			const F32x8 r = static_cast< F32x8 >(a * 2.0f + 1.0f);
+			MAML_CHECK(3.0f == r[0] && 17.0f == r[7]);
+			const F32x8S b(F32x4S(1.0f, 2.0f, 3.0f, 4.0f), F32x4S(5.0f, 6.0f, 7.0f, 8.0f));
+			MAML_CHECK(All(a == b) && 5.0f == b.Hi().X() && 4.0f == b.Lo().W());
+
+			const F64x4S d = F64x4S(F32x4S(1.0f, 2.0f, 3.0f, 4.0f)) * 2.0 - 1.0;
+			MAML_CHECK(1.0 == d.X() && 7.0 == d.W());
+		}
+		#endif
+	}
+
+	void CheckBatch() {
+		std::vector< F32 > a(1003u), r(1003u);
+		std::vector< F64 > d(1003u), e(1003u);
+		for (std::size_t i = 0u; i < a.size(); ++i) {
+			a[i] = static_cast< F32 >(i % 7u) * 0.5f;
+			d[i] = static_cast< F64 >(i) * 0.25;
+		}
+
+		const SIMDLevel level = GetSIMDLevel();
+		for (SIMDLevel l : { SIMDLevel::None, SIMDLevel::SSE2, SIMDLevel::SSE4_1,
+							 SIMDLevel::AVX2, SIMDLevel::AVX512 }) {
+			SetSIMDLevel(l);
+			MAML_CHECK(GetSIMDLevel() <= GetSupportedSIMDLevel());
+
+			MAML_CHECK(Near(Sum(a), 1502.0, 1e-3));
+			MAML_CHECK(Near(Dot(a, a), 3253.5, 1e-2));
+			MulAdd(a, 2.0f, 1.0f, r);
+			MAML_CHECK(1.0f == r[0] && 2.0f == r[1002]);
+			Convert(d, r);
+			Convert(r, e);
+			MAML_CHECK(250.5f == r[1002] && 250.25 == e[1001]);
+		}
+		SetSIMDLevel(level);
+	}
+
+	void CheckHorizontalOperations() {
+		const F32x4S a(1.0f, -2.0f, 3.0f, 4.0f);
+		const F32x4S b(2.0f);
+		MAML_CHECK(12.0f == Dot(a, b).X() && 12.0f == Dot(a, b).W());
+		MAML_CHECK(6.0f == HorizontalSum(a).Y());
+		MAML_CHECK(-2.0f == Min(a, b).Y() && 4.0f == Max(a, b).W());
+		MAML_CHECK(2.0f == Abs(a).Y() && 2.0f == Sqrt(F32x4S(4.0f)).Z());
+		MAML_CHECK(Near(Rsqrt< true >(F32x4S(4.0f)).X(), 0.5, 1e-6));
+		MAML_CHECK(Near(Rcp< true >(F32x4S(3.0f)).X(), 1.0 / 3.0, 1e-6));
+		MAML_CHECK(4.0f == FMA(a, b, b).X() && 0.0f == FMS(a, b, b).X());
+	}
+
+	void CheckIntegerVectors() {
+		const S32x4S a(-7, 3, 2147483647, -2147483647 - 1);
+		const S32x4S b(5, -4, -1, 9);
+		const S32x4S p = a * b;
+		MAML_CHECK(-35 == p.X() && -12 == p.Y() && -2147483647 == p.Z());
+		MAML_CHECK(-1 == Min(a, b).Z() && 9 == Max(a, b).W());
+		MAML_CHECK(7 == Abs(a).X() && 4 == Abs(b).Y());
+
+		const U32x4S u(1u, 0xFFFFFFFFu, 70000u, 65535u);
+		const U32x4S v(2u, 3u, 0x80000000u, 65536u);
+		MAML_CHECK(0xFFFFFFFDu == (u * v).Y());
+		MAML_CHECK(3u == Min(u, v).Y() && 0x80000000u == Max(u, v).Z());
+
+		const U16x8 s = U16x8(U16x8S(u, v));
+		MAML_CHECK(1u == s[0] && 65535u == s[1] && 65535u == s[2] && 3u == s[5]);
+
+		const U16x8S c(1u, 65535u, 40000u, 0u, 5u, 32768u, 32767u, 100u);
+		const U16x8S d(2u, 1u, 50000u, 0u, 4u, 32767u, 32768u, 100u);
+		const U16x8 mn = U16x8(Min(c, d));
+		const U16x8 mx = U16x8(Max(c, d));
+		MAML_CHECK(1u == mn[1] && 40000u == mn[2] && 32767u == mn[5]);
+		MAML_CHECK(65535u == mx[1] && 50000u == mx[2] && 32768u == mx[6]);
+	}
+
+	void CheckLoadsAndStores() {
+		alignas(16) F32 buffer[8] = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f };
+		F32x4A a(1.0f, 2.0f, 3.0f, 4.0f);
+
+		const F32x4S v = F32x4S::Load(a) + F32x4S::LoadUnaligned(buffer + 1);
+		MAML_CHECK(2.0f == v.X() && 8.0f == v.W());
+		v.Store(a);
+		MAML_CHECK(2.0f == a[0] && 8.0f == a[3]);
+		v.StoreStream(buffer + 4);
+		_mm_sfence();
+		MAML_CHECK(8.0f == buffer[7]);
+		v.StoreUnaligned(buffer + 1);
+		MAML_CHECK(2.0f == buffer[1] && F32x4S::Load(buffer).Y() == 2.0f);
+	}
+
+	void CheckSwizzles() {
+		const F32x4S a(1.0f, 2.0f, 3.0f, 4.0f);
+		const F32x4S b(5.0f, 6.0f, 7.0f, 8.0f);
+
+		MAML_CHECK(All(F32x4S(4.0f, 3.0f, 2.0f, 1.0f) == Swizzle< 3u, 2u, 1u, 0u >(a)));
+		MAML_CHECK(All(F32x4S(1.0f, 5.0f, 2.0f, 6.0f) == Shuffle< 0u, 4u, 1u, 5u >(a, b)));
+		MAML_CHECK(All(F32x4S(4.0f, 8.0f, 1.0f, 7.0f) == Shuffle< 3u, 7u, 0u, 6u >(a, b)));
+		MAML_CHECK(All(F32x4S(5.0f, 2.0f, 7.0f, 4.0f) == Blend< 0x5u >(a, b)));
+
+		const F32x4S c = Cross(F32x4S(1.0f, 0.0f, 0.0f, 1e30f), F32x4S(0.0f, 1.0f, 0.0f, 1e30f));
+		MAML_CHECK(All(F32x4S(0.0f, 0.0f, 1.0f, 0.0f) == c));
+
+		F32x4S r0 = a, r1 = b, r2 = a + 8.0f, r3 = b + 8.0f;
+		Transpose(r0, r1, r2, r3);
+		MAML_CHECK(All(F32x4S(1.0f, 5.0f, 9.0f, 13.0f) == r0));
+		MAML_CHECK(All(F32x4S(4.0f, 8.0f, 12.0f, 16.0f) == r3));
+	}
+
+	void CheckMasks() {
+		const F32x4S a(1.0f, 2.0f, 3.0f, 4.0f);
+		const F32x4S b(4.0f, 3.0f, 2.0f, 1.0f);
+
+		MAML_CHECK(0x3u == MoveMask(a < b) && 0xCu == MoveMask(a > b));
+		MAML_CHECK(Any(a < b) && !All(a < b) && None(a == b));
+		MAML_CHECK(All(F32x4S(1.0f, 2.0f, 2.0f, 1.0f) == Select(a < b, a, b)));
+	}
+
+	void CheckTranscendentals() {
+		for (F32 x : { -20.0f, -1.5f, -0.5f, 0.0f, 0.25f, 1.0f, 2.5f, 10.0f, 1e4f }) {
+			const F64 y = static_cast< F64 >(x);
+			const F32x4S v(x);
+			MAML_CHECK(Near(Sin(v).X(), std::sin(y), 1e-6));
+			MAML_CHECK(Near(Cos(v).Y(), std::cos(y), 1e-6));
+			MAML_CHECK(Near(Atan2(v, F32x4S(-1.0f)).Z(), std::atan2(y, -1.0), 1e-6));
+			if (Abs(x) <= 20.0f) {
+				MAML_CHECK(Near(Exp(v).W() / std::exp(y), 1.0, 1e-6));
+				MAML_CHECK(Near(Cosh(v).X() / std::cosh(y), 1.0, 1e-6));
+			}
+			if (0.0f < x) {
+				MAML_CHECK(Near(Log(v).X(), std::log(y), 1e-6));
+				MAML_CHECK(Near(Pow(v, F32x4S(1.5f)).X() / std::pow(y, 1.5), 1.0, 1e-5));
+			}
+		}
+	}
+
+	void CheckMatrices() {
+		const F32x4x4 m = { F32x4(2.0f, 0.0f, 0.0f, 0.0f), F32x4(0.0f, 4.0f, 0.0f, 0.0f),
+							F32x4(0.0f, 0.0f, 8.0f, 0.0f), F32x4(1.0f, 2.0f, 3.0f, 1.0f) };
+		static_assert(Determinant(F32x4x4{ F32x4(2.0f, 0.0f, 0.0f, 0.0f), F32x4(0.0f, 4.0f, 0.0f, 0.0f),
+										   F32x4(0.0f, 0.0f, 8.0f, 0.0f), F32x4(1.0f, 2.0f, 3.0f, 1.0f) }) == 64.0f);
+
+		const F32x4x4S a(m);
+		MAML_CHECK(64.0f == Determinant(a).X());
+
+		const F32x4x4 i = static_cast< F32x4x4 >(Inverse(a) * a);
+		const F32x4x4 j = static_cast< F32x4x4 >(InverseAffine(a) * a);
+		for (std::size_t c = 0u; c < 4u; ++c) {
+			for (std::size_t r = 0u; r < 4u; ++r) {
+				const F64 expected = (c == r) ? 1.0 : 0.0;
+				MAML_CHECK(Near(i[c][r], expected, 1e-6) && Near(j[c][r], expected, 1e-6));
+			}
+		}
+	}
+
+	void CheckQuaternions() {
+		constexpr F32 pi = std::numbers::pi_v< F32 >;
+		const Q32S q = Q32S::FromAxisAngle(F32x3(0.0f, 0.0f, 1.0f), 0.5f * pi);
+
+		const F32x3 r = q.Rotate(F32x3(1.0f, 0.0f, 0.0f));
+		MAML_CHECK(Near(r[0], 0.0, 1e-6) && Near(r[1], 1.0, 1e-6) && Near(r[2], 0.0, 1e-6));
+
+		const Q32 f = static_cast< Q32 >(Q32S::FromMatrix(q.ToMatrix()));
+		const Q32 e = static_cast< Q32 >(q);
+		MAML_CHECK(Near(Abs(f.Z()), Abs(e.Z()), 1e-6) && Near(Abs(f.W()), Abs(e.W()), 1e-6));
+
+		const Q32 s = static_cast< Q32 >(Slerp(Q32S(), q, 0.5f));
+		MAML_CHECK(Near(s.Z(), std::sin(0.125 * std::numbers::pi), 1e-6));
+		const Q32 n = static_cast< Q32 >(Nlerp(Q32S(), q, 1.0f));
+		MAML_CHECK(Near(n.Z(), e.Z(), 1e-6) && Near(n.W(), e.W(), 1e-6));
+	}
+
+	void CheckSoA() {
+		std::vector< F32x3 > values(17u);
+		for (std::size_t i = 0u; i < values.size(); ++i) {
+			values[i] = F32x3(static_cast< F32 >(i), 1.0f, -1.0f);
+		}
+
+		SoA< F32x3 > soa{ std::span< const F32x3 >(values) };
+		MAML_CHECK(17u == soa.size() && values[5] == soa.Get(5u));
+		soa.ForEachChunk([](Array< F32x4S, 3u >& chunk) { chunk[0u] = chunk[0u] * 2.0f; });
+
+		std::vector< F32x3 > result(17u);
+		soa.Store(result);
+		MAML_CHECK(32.0f == result[16][0] && 1.0f == result[16][1]);
+
+		// Elements exposed again by resizing within the capacity are zero.
+		soa.resize(2u);
+		soa.resize(4u);
+		MAML_CHECK(F32x3() == soa.Get(2u) && F32x3() == soa.Get(3u));
+	}
+
+	void CheckPackets() {
+		const std::vector< C32 > a = { C32(1.0f, 2.0f), C32(-3.0f, 0.5f), C32(0.0f, 1.0f), C32(2.0f, -2.0f) };
+		const std::vector< C32 > b = { C32(3.0f, 4.0f), C32(1.0f, -1.0f), C32(2.0f, 2.0f), C32(0.5f, 0.0f) };
+		std::vector< C32 > c(4u);
+		StorePacket(LoadPacket< C32 >(a) * LoadPacket< C32 >(b), std::span< C32 >(c));
+		for (std::size_t i = 0u; i < c.size(); ++i) {
+			MAML_CHECK(a[i] * b[i] == c[i]);
+		}
+
+		const std::vector< D32 > d = { D32(1.0f, 2.0f), D32(-3.0f, 0.5f), D32(4.0f, 1.0f), D32(2.0f, -2.0f) };
+		std::vector< D32 > e(4u);
+		StorePacket(LoadPacket< D32 >(d) * LoadPacket< D32 >(d), std::span< D32 >(e));
+		for (std::size_t i = 0u; i < e.size(); ++i) {
+			MAML_CHECK(d[i] * d[i] == e[i]);
+		}
+	}
+
+	void CheckFFT() {
+		std::vector< C64 > x(8u), y(8u);
+		x[0] = C64(1.0, 0.0);
+		FFTPlan< F64 > plan(8u);
+		plan.Forward(x, y);
+		for (const C64& v : y) {
+			MAML_CHECK(Near(v.Re(), 1.0, 1e-12) && Near(v.Im(), 0.0, 1e-12));
+		}
+
+		for (std::size_t i = 0u; i < x.size(); ++i) {
+			x[i] = C64(std::cos(0.7 * i), std::sin(1.3 * i));
+		}
+		plan.Forward(x, y);
+		plan.Inverse(y, y);
+		for (std::size_t i = 0u; i < x.size(); ++i) {
+			MAML_CHECK((y[i] - x[i]).Abs() < 1e-12);
+		}
+	}
+
+	void CheckGradientDuals() {
+		constexpr GD64< 2u > x = GD64< 2u >::Variable(2.0, 0u);
+		constexpr GD64< 2u > y = GD64< 2u >::Variable(3.0, 1u);
+		static_assert(Array< F64, 2u >(3.0, 2.0) == (x * y).Du());
+
+		const GD64< 2u > f = x * y + Sin(x) + Exp(y * 0.5);
+		MAML_CHECK(Near(f.Du()[0], 3.0 + std::cos(2.0), 1e-12));
+		MAML_CHECK(Near(f.Du()[1], 2.0 + 0.5 * std::exp(1.5), 1e-12));
+
+		const GD64< 2u > g = Pow(x - 4.0, GD64< 2u >(3.0));
+		MAML_CHECK(Near(g.Re(), -8.0, 1e-12) && Near(g.Du()[0], 12.0, 1e-12));
+	}
+
+	void CheckTape() {
+		Tape< F64 > tape(16u);
+		const Var< F64 > x = tape.Variable(2.0);
+		const Tape< F64 >::Checkpoint checkpoint = tape.GetCheckpoint();
+
+		for (int i = 0; i < 2; ++i) {
+			tape.Rewind(checkpoint);
+			const Var< F64 > y = x * x + Sin(x);
+			tape.Backward(y);
+			MAML_CHECK(Near(tape.Gradient(x), 4.0 + std::cos(2.0), 1e-12));
+		}
+	}
+
+	void CheckDuals() {
+		static_assert(D64(2.0, -2.0) == 3.0 - D64(1.0, 2.0));
+		constexpr D64 a = Atan2(D64(1.0, 1.0), D64(1.0, 0.0));
+		static_assert(Abs(a.Du() - 0.5) < 1e-15);
+
+		const D64 p = Pow(D64(-2.0, 1.0), D64(3.0, 0.0));
+		MAML_CHECK(Near(p.Re(), -8.0, 1e-12) && Near(p.Du(), 12.0, 1e-12));
+		const D64 z = Pow(D64(0.0, 1.0), D64(2.0, 0.0));
+		MAML_CHECK(0.0 == z.Re() && 0.0 == z.Du());
+
+		D64 q(3.0, 1.0);
+		q /= D64(2.0, 1.0);
+		MAML_CHECK(D64(3.0, 1.0) / D64(2.0, 1.0) == q);
+	}
+
+	void CheckHyperDuals() {
+		const HD64 p = Pow(HD64(-2.0, 1.0, 1.0, 0.0), HD64(3.0));
+		MAML_CHECK(Near(p.Re(), -8.0, 1e-12) && Near(p.E1(), 12.0, 1e-12));
+		MAML_CHECK(Near(p.E2(), 12.0, 1e-12) && Near(p.E12(), -12.0, 1e-12));
+
+		const HD64 e = Exp(HD64(0.5, 1.0, 1.0, 0.0));
+		MAML_CHECK(Near(e.E12(), std::exp(0.5), 1e-12));
+	}
+
+	void CheckComplexNumbers() {
+		static_assert(C64(2.0, -2.0) == 3.0 - C64(1.0, 2.0));
+
+		const C64 l = Ln(C64(1e300, 1e300));
+		MAML_CHECK(Near(l.Re(), std::log(1e300) + 0.5 * std::numbers::ln2, 1e-12));
+		MAML_CHECK(Near(l.Im(), 0.25 * std::numbers::pi, 1e-15));
+
+		const C64 s = Sqrt(C64(-4.0, 0.0));
+		MAML_CHECK(Near(s.Re(), 0.0, 1e-15) && Near(s.Im(), 2.0, 1e-15));
+
+		const std::vector< C32 > values = { C32(3.0f, 4.0f), C32(-1.0f, 0.0f), C32(0.0f, -2.0f),
+											C32(1.0f, 1.0f), C32(-5.0f, 2.0f) };
+		std::vector< F32 > r(values.size()), phi(values.size());
+		std::vector< C32 > result(values.size());
+		ToPolar(values, r, phi);
+		FromPolar(r, phi, result);
+		MAML_CHECK(5.0f == r[0]);
+		for (std::size_t i = 0u; i < values.size(); ++i) {
+			MAML_CHECK((result[i] - values[i]).Abs() < 1e-5f);
+		}
+	}
+
+	void CheckOscillators() {
+		const SIMDLevel level = GetSIMDLevel();
+		for (SIMDLevel l : { SIMDLevel::None, SIMDLevel::SSE2, SIMDLevel::AVX2 }) {
+			SetSIMDLevel(l);
+
+			OscillatorBank bank(3u);
+			for (std::size_t k = 0u; k < 3u; ++k) {
+				bank.SetFrequency(k, 0.01f + 0.05f * k);
+				bank.SetPhase(k, 0.25f * k);
+				bank.SetAmplitude(k, 1.0f / (k + 1u));
+			}
+
+			std::vector< F32 > output(256u);
+			bank.Render(output);
+			for (std::size_t t = 0u; t < output.size(); ++t) {
+				F64 expected = 0.0;
+				for (std::size_t k = 0u; k < 3u; ++k) {
+					expected += std::sin(F64(0.25f * k) + F64(0.01f + 0.05f * k) * t) / (k + 1u);
+				}
+				MAML_CHECK(Near(output[t], expected, 1e-4));
+			}
+			MAML_CHECK(Near(bank.GetPhasor(1u).Abs(), 1.0, 1e-5));
+		}
+		SetSIMDLevel(level);
+	}
+
+	void CheckBoosts() {
+		const H32 boost = H32::FromRapidity(0.4f);
+		MAML_CHECK(Near(Compose(boost, H32::FromRapidity(-1.1f)).Rapidity(), -0.7, 1e-5));
+
+		std::vector< H32 > events(11u);
+		for (std::size_t i = 0u; i < events.size(); ++i) {
+			events[i] = H32(1.0f + i, 0.5f * i);
+		}
+		const std::vector< H32 > expected = events;
+		Boost(events, boost);
+		for (std::size_t i = 0u; i < events.size(); ++i) {
+			const H32 e = Boost(expected[i], boost);
+			MAML_CHECK(Near(events[i].Re(), e.Re(), 1e-5) && Near(events[i].Im(), e.Im(), 1e-5));
+		}
+	}
+
+	void CheckConstexprMath() {
+		constexpr F64 infinity = std::numeric_limits< F64 >::infinity();
+		static_assert(Ln(1.0) == 0.0 && Sqrt(4.0) == 2.0);
+		static_assert(Abs(Sin(100.0) + 0.50636564110975879) < 1e-14);
+		static_assert(Abs(Pow(-2.0, 3.0) + 8.0) < 1e-14);
+		static_assert(-infinity == Pow(-0.0, -1.0) && infinity == Pow(-0.0, -2.0));
+		static_assert(Abs(SinCos(0.5).first - 0.479425538604203) < 1e-15);
+
+		// At runtime the functions forward to the standard library.
+		for (F64 x : { 0.1, 0.5, 2.0, 100.0 }) {
+			MAML_CHECK(std::sin(x) == Sin(x) && std::exp(x) == Exp(x) && std::log(x) == Ln(x));
+		}
+	}
+
+	void CheckConstexprAlgebra() {
+		static_assert(Abs(Atanh(0.3) - 0.30951960420311175) < 1e-15);
+		static_assert(Abs(H64::FromRapidity(0.75).Rapidity() - 0.75) < 1e-15);
+		constexpr Quaternion< F64 > q = Quaternion< F64 >::FromAxisAngle(Array< F64, 3u >(0.0, 0.0, 1.0), 1.0);
+		static_assert(Abs(q.Z() - 0.479425538604203) < 1e-15);
+		static_assert(5.0 == Quaternion< F64 >(1.0, 2.0, 2.0, 4.0).Abs());
+		static_assert(Abs([] { H64 h(2.0, 1.0); h.Normalize(); return h.Modulus(); }() - 1.0) < 1e-15);
+	}
+
+	using SinLUT = LUT< decltype([](F64 x) { return Sin(x); }), 256u, 0.0, 2.0 * std::numbers::pi >;
+
+	void CheckLUT() {
+		static_assert(258u == SinLUT::s_table.size());
+		const F64 error = SinLUT::EstimateLinearError();
+
+		for (int k = -10; k <= 1010; ++k) {
+			const F32 x = static_cast< F32 >(k) * 6.2831853f / 1000.0f;
+			const F64 expected = std::sin(static_cast< F64 >(Clamp(x, 0.0f, 6.2831853f)));
+			MAML_CHECK(Near(SinLUT::Linear(x), expected, 1.01 * error + 1e-6));
+			MAML_CHECK(Near(SinLUT::Cubic(x), expected, 1e-6));
+			MAML_CHECK(Near(SinLUT::Cubic(F32x4S(x)).Y(), SinLUT::Cubic(x), 1e-6));
+		}
+	}
+
+	using ExpFunction = decltype([](F64 x) { return Exp(x); });
+
+	void CheckApproximations() {
+		constexpr std::array< F64, 9u > coefficients = ChebyshevFit< ExpFunction, 8u >(-1.0, 1.0);
+		MAML_CHECK(EstimateError< ExpFunction >(coefficients, -1.0, 1.0) < 1e-7);
+
+		for (F32 x : { -10.0f, -1.0f, 0.5f, 3.0f }) {
+			const F64 y = static_cast< F64 >(x);
+			MAML_CHECK(Near(Sin< Precision::Fast >(x), std::sin(y), 1e-3));
+			MAML_CHECK(Near(Sin< Precision::Full >(x), std::sin(y), 1e-6));
+			MAML_CHECK(Near(Exp< Precision::Full >(x) / std::exp(y), 1.0, 1e-6));
+			MAML_CHECK(Near(Sin< Precision::Medium >(F32x4S(x)).X(), Sin< Precision::Medium >(x), 1e-6));
+		}
+		MAML_CHECK(Near(Log< Precision::Full >(10.0f), std::log(10.0), 1e-6));
+	}
+
+	using P4 = Polynomial< F32, 1.0f, -0.5f, 0.25f, 0.125f, -0.0625f >;
+
+	void CheckPolynomials() {
+		static_assert(17.0 == EvalPoly(2.0, std::array< F64, 3u >{ 1.0, 2.0, 3.0 }));
+		static_assert(EvalHorner(2.0, std::array< F64, 6u >{ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 })
+				   == EvalEstrin(2.0, std::array< F64, 6u >{ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 }));
+		static_assert(1.0f == P4::Evaluate(0.0f) && 4u == P4::s_degree);
+
+		std::vector< F32 > x(37u), y(37u);
+		for (std::size_t i = 0u; i < x.size(); ++i) {
+			x[i] = -1.5f + 0.08f * i;
+		}
+		P4::Evaluate(x, y);
+		for (std::size_t i = 0u; i < x.size(); ++i) {
+			MAML_CHECK(Near(y[i], P4::Evaluate(x[i]), 1e-6));
+		}
+	}
+}
+
 int main() {
 
 	const F32x4S simd1(5.0f);
 	const F32x4S simd2(7.0f);
 	const F32x4S smul = simd1 * simd2;
-	
+
 	constexpr C32 c1(1.0f, 2.0f);
 	constexpr C32 c2(3.0f, 4.0f);
 	constexpr C32 cmul = c1 * c2;
@@ -31,5 +491,33 @@ int main() {
 
 	constexpr F32 s = maml::Sin(3.14f);
 
-	return 0;
-}
\ No newline at end of file
+	CheckVectors();
+	CheckBatch();
+	CheckHorizontalOperations();
+	CheckIntegerVectors();
+	CheckLoadsAndStores();
+	CheckSwizzles();
+	CheckMasks();
+	CheckTranscendentals();
+	CheckMatrices();
+	CheckQuaternions();
+	CheckSoA();
+	CheckPackets();
+	CheckFFT();
+	CheckGradientDuals();
+	CheckTape();
+	CheckDuals();
+	CheckHyperDuals();
+	CheckComplexNumbers();
+	CheckOscillators();
+	CheckBoosts();
+	CheckConstexprMath();
+	CheckConstexprAlgebra();
+	CheckLUT();
+	CheckApproximations();
+	CheckPolynomials();
+
+	std::cout << g_nb_failures << " failed checks" << std::endl;
+
+	return (0 == g_nb_failures) ? 0 : 1;
+}
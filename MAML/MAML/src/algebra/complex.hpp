@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "constexpr\math.hpp"
 
 #pragma endregion
 
@@ -28,7 +28,7 @@ namespace maml {
 	//-------------------------------------------------------------------------
 
 	template< typename T, 
-		      typename = std::enable_if_t< std::is_floating_point_v< T > > >
+		      typename = std::enable_if_t< IsScalarLike< T >::value > >
 	struct Complex : public Array< T, 2u > {
 
 	public:
@@ -174,19 +174,14 @@ namespace maml {
 		Complex& operator*=(const Complex& v) noexcept {
 			// (Re, Im) * (v.Re, v.Im) = (Re * v.Re - Im * v.Im, 
 			//                            Im * v.Re + Re * v.Im)
-			Re() = Re() * v.Re() - Im() * v.Im();
-			Im() = Re() * v.Im() + Im() * v.Re();
-			return *this;
+			return *this = *this * v;
 		}
 		
 		Complex& operator/=(const Complex& v) noexcept {
 			// (Re, Im) / (v.Re, v.Im) = 1 / (v.Re^2 + v.Im^2) * 
 			//                           (Re * v.Re + Im * v.Im, 
 			//                            Im * v.Re - Re * v.Im)
-			const T inv = T(1) / v.SqrAbs();
-			Re() = inv * (Re() * v.Re() + Im() * v.Im());
-			Im() = inv * (Im() * v.Re() - Re() * v.Im());
-			return *this;
+			return *this = *this / v;
 		}
 		
 		Complex& operator+=(T a) noexcept {
@@ -218,7 +213,12 @@ namespace maml {
 
 		[[nodiscard]]
 		constexpr bool operator==(const Complex& v) const {
-			return Re() == v.Re() && Im() == v.Im();
+			if constexpr (std::is_floating_point_v< T >) {
+				return Re() == v.Re() && Im() == v.Im();
+			}
+			else {
+				return All((Re() == v.Re()) & (Im() == v.Im()));
+			}
 		}
 		
 		[[nodiscard]]
@@ -242,8 +242,8 @@ namespace maml {
 		}
 		
 		[[nodiscard]]
-		const T Abs() const noexcept {
-			return std::sqrt(SqrAbs());
+		constexpr const T Abs() const noexcept {
+			return Sqrt(SqrAbs());
 		}
 		
 		Complex& Normalize() noexcept {
@@ -254,8 +254,8 @@ namespace maml {
 		}
 		
 		[[nodiscard]]
-		const T Arg() const noexcept {
-			return std::atan2(Im(), Re());
+		constexpr const T Arg() const noexcept {
+			return Atan2(Im(), Re());
 		}
 	};
 
@@ -269,8 +269,8 @@ namespace maml {
 	template< typename T >
 	[[nodiscard]]
 	constexpr const Complex< T > operator-(T a, const Complex< T >& v) noexcept {
-		// (a, 0) - (v.Re, v.Im) = (a - v.Re, v.Im)
-		return v - a;
+		// (a, 0) - (v.Re, v.Im) = (a - v.Re, -v.Im)
+		return -v + a;
 	}
 	
 	template< typename T >
@@ -288,6 +288,100 @@ namespace maml {
 		return { inv * (a * v.Re()), inv * (-a * v.Im()) };
 	}
 
+	//-------------------------------------------------------------------------
+	// Elementary Functions
+	//-------------------------------------------------------------------------
+
+	// All functions are constexpr for floating points (see 
+	// constexpr\math.hpp). Ln, Sqrt and Pow return the principal value 
+	// (the branch cut lies along the negative real axis).
+
+	/**
+	 Constructs the complex number with the given magnitude and argument.
+	 */
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Complex< T > FromPolar(T r, T phi) noexcept {
+		// r (cos(phi), sin(phi))
+		const auto [sin, cos] = SinCos(phi);
+		return { r * cos, r * sin };
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Complex< T > Exp(const Complex< T >& v) noexcept {
+		// exp(Re, Im) = exp(Re) (cos(Im), sin(Im))
+		return FromPolar(Exp(v.Re()), v.Im());
+	}
+
+	namespace details {
+
+		// ln(|v|) without overflowing or underflowing |v|^2: with
+		// m = max(|Re|, |Im|) and r = min(|Re|, |Im|) / m,
+		// ln(|v|) = ln(m) + ln(1 + r^2) / 2.
+		template< typename T >
+		[[nodiscard]]
+		constexpr const T LnAbs(const Complex< T >& v) noexcept {
+			const T a = Abs(v.Re());
+			const T b = Abs(v.Im());
+			if constexpr (std::is_floating_point_v< T >) {
+				const T m = (a < b) ? b : a;
+				const T r = ((a < b) ? a : b) / m;
+				// r is NaN for 0 / 0 and inf / inf.
+				const T s = (r != r) ? T(0) : r;
+				return Ln(m) + T(0.5) * Ln(T(1) + s * s);
+			}
+			else {
+				const T m = Max(a, b);
+				const T r = Min(a, b) / m;
+				const T s = Select(r == r, r, T(0));
+				return Ln(m) + T(0.5) * Ln(T(1) + s * s);
+			}
+		}
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Complex< T > Ln(const Complex< T >& v) noexcept {
+		// ln(Re, Im) = (ln(|v|), arg(v))
+		return { details::LnAbs(v), v.Arg() };
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Complex< T > Log(const Complex< T >& v) noexcept {
+		return Ln(v);
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Complex< T > Sqrt(const Complex< T >& v) noexcept {
+		// sqrt(Re, Im) = (sqrt((|v| + Re) / 2), sign(Im) sqrt((|v| - Re) / 2))
+		const T abs = v.Abs();
+
+		// Max guards against rounding below zero.
+		const T half(0.5f);
+		const T zero(0.0f);
+		return {
+			Sqrt(Max(half * (abs + v.Re()), zero)),
+			CopySign(Sqrt(Max(half * (abs - v.Re()), zero)), v.Im())
+		};
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Complex< T > Pow(const Complex< T >& v, const Complex< T >& exponent) noexcept {
+		// v^e = exp(e ln(v))
+		return Exp(exponent * Ln(v));
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Complex< T > Pow(const Complex< T >& v, T exponent) noexcept {
+		// v^a = |v|^a (cos(a arg(v)), sin(a arg(v)))
+		return FromPolar(Pow(v.Abs(), exponent), exponent * v.Arg());
+	}
+
 	//-------------------------------------------------------------------------
 	// Type Declarations and Definitions
 	//-------------------------------------------------------------------------
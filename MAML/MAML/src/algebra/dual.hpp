@@ -5,7 +5,16 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "constexpr\math.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
 
 #pragma endregion
 
@@ -19,7 +28,7 @@ namespace maml {
 	//-------------------------------------------------------------------------
 
 	template< typename T, 
-		      typename = std::enable_if_t< std::is_floating_point_v< T > > >
+		      typename = std::enable_if_t< IsScalarLike< T >::value > >
 	struct Dual : public Array< T, 2u > {
 
 	public:
@@ -159,8 +168,8 @@ namespace maml {
 		
 		Dual& operator*=(const Dual& v) noexcept {
 			// (Re, Im) * (v.Re, v.Im) = (Re * v.Re, Re * v.Du + Du * v.Re)
-			Re() = Re() * v.Re();
 			Du() = Re() * v.Du() + Du() * v.Re();
+			Re() = Re() * v.Re();
 			return *this;
 		}
 		
@@ -168,8 +177,8 @@ namespace maml {
 			// (Re, Im) / (v.Re, v.Im) = (Re / v.Re, 
 			//                            (Du * v.Re - Re * v.Du) / v.Re^2)
 			const T inv_Re = T(1) / v.Re();
-			Re() *= inv_Re;
 			Du()  = inv_Re * inv_Re * (Du() * v.Re() - Re() * v.Du());
+			Re() *= inv_Re;
 			return *this;
 		}
 		
@@ -202,7 +211,12 @@ namespace maml {
 
 		[[nodiscard]]
 		constexpr bool operator==(const Dual& v) const {
-			return Re() == v.Re() && Du() == v.Du();
+			if constexpr (std::is_floating_point_v< T >) {
+				return Re() == v.Re() && Du() == v.Du();
+			}
+			else {
+				return All((Re() == v.Re()) & (Du() == v.Du()));
+			}
 		}
 		
 		[[nodiscard]]
@@ -221,8 +235,8 @@ namespace maml {
 	template< typename T >
 	[[nodiscard]]
 	constexpr const Dual< T > operator-(T a, const Dual< T >& v) noexcept {
-		// (a, 0) - (v.Re, v.Du) = (a - v.Re, v.Du)
-		return v - a;
+		// (a, 0) - (v.Re, v.Du) = (a - v.Re, -v.Du)
+		return -v + a;
 	}
 	
 	template< typename T >
@@ -240,6 +254,89 @@ namespace maml {
 		return { inv * a, inv * inv * (-a * v.Du()) };
 	}
 
+	//-------------------------------------------------------------------------
+	// Elementary Functions
+	//-------------------------------------------------------------------------
+
+	// f(Re, Du) = (f(Re), f'(Re) * Du)
+	//
+	// Exp, Ln, Sqrt, Pow, Sin, Cos and Atan2 are constexpr for floating
+	// points (see constexpr\math.hpp).
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Dual< T > Exp(const Dual< T >& v) noexcept {
+		// exp(Re, Du) = (exp(Re), exp(Re) * Du)
+		const T exp = Exp(v.Re());
+		return { exp, exp * v.Du() };
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Dual< T > Ln(const Dual< T >& v) noexcept {
+		// ln(Re, Du) = (ln(Re), Du / Re)
+		return { Ln(v.Re()), v.Du() / v.Re() };
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Dual< T > Sqrt(const Dual< T >& v) noexcept {
+		// sqrt(Re, Du) = (sqrt(Re), Du / (2 sqrt(Re)))
+		const T sqrt = Sqrt(v.Re());
+		return { sqrt, v.Du() / (sqrt + sqrt) };
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Dual< T > Pow(const Dual< T >& v, const Dual< T >& exponent) noexcept {
+		// (Re, Du)^(e.Re, e.Du) = (Re^e.Re, 
+		//                          e.Re * Re^(e.Re-1) * Du + Re^e.Re * ln(Re) * e.Du)
+		// The second term is only added where e.Du != 0, since ln(Re) is NaN
+		// for Re < 0.
+		const Dual< T > pow = Pow(v, exponent.Re());
+		const T du = pow.Du() + pow.Re() * Ln(v.Re()) * exponent.Du();
+		if constexpr (std::is_floating_point_v< T >) {
+			return { pow.Re(), (T(0) == exponent.Du()) ? pow.Du() : du };
+		}
+		else {
+			return { pow.Re(), Select(T(0) == exponent.Du(), pow.Du(), du) };
+		}
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Dual< T > Pow(const Dual< T >& v, T exponent) noexcept {
+		// (Re, Du)^a = (Re^a, a * Re^(a-1) * Du)
+		const T pow = Pow(v.Re(), exponent - T(1));
+		return { Pow(v.Re(), exponent), exponent * pow * v.Du() };
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Dual< T > Sin(const Dual< T >& v) noexcept {
+		// sin(Re, Du) = (sin(Re), cos(Re) * Du)
+		const auto [sin, cos] = SinCos(v.Re());
+		return { sin, cos * v.Du() };
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Dual< T > Cos(const Dual< T >& v) noexcept {
+		// cos(Re, Du) = (cos(Re), -sin(Re) * Du)
+		const auto [sin, cos] = SinCos(v.Re());
+		return { cos, -sin * v.Du() };
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Dual< T > Atan2(const Dual< T >& y, const Dual< T >& x) noexcept {
+		// atan2((y.Re, y.Du), (x.Re, x.Du)) = 
+		//    (atan2(y.Re, x.Re), (x.Re * y.Du - y.Re * x.Du) / (x.Re^2 + y.Re^2))
+		const T du = (x.Re() * y.Du() - y.Re() * x.Du())
+			       / (x.Re() * x.Re() + y.Re() * y.Re());
+		return { Atan2(y.Re(), x.Re()), du };
+	}
+
 	//-------------------------------------------------------------------------
 	// Type Declarations and Definitions
 	//-------------------------------------------------------------------------
@@ -0,0 +1,478 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "constexpr\math.hpp"
+#include "simd\cpu.hpp"
+#include "simd\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <type_traits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	namespace details {
+
+		// Computes a * x + b * y with one FMA per packet.
+		template< typename VectorT, typename T, std::size_t N >
+		[[nodiscard]]
+		inline const Array< T, N > __vectorcall PacketLinearCombination(T a, const Array< T, N >& x,
+																		T b, const Array< T, N >& y) noexcept {
+			constexpr std::size_t width = sizeof(VectorT) / sizeof(T);
+
+			const VectorT va(a);
+			const VectorT vb(b);
+			Array< T, N > result;
+			for (std::size_t i = 0u; i < N; i += width) {
+				const VectorT vx = VectorT::LoadUnaligned(x.data() + i);
+				const VectorT vy = VectorT::LoadUnaligned(y.data() + i);
+				FMA(va, vx, vb * vy).StoreUnaligned(result.data() + i);
+			}
+			return result;
+		}
+
+		// Computes a * x.
+		template< typename VectorT, typename T, std::size_t N >
+		[[nodiscard]]
+		inline const Array< T, N > __vectorcall PacketScale(T a, const Array< T, N >& x) noexcept {
+			constexpr std::size_t width = sizeof(VectorT) / sizeof(T);
+
+			const VectorT va(a);
+			Array< T, N > result;
+			for (std::size_t i = 0u; i < N; i += width) {
+				(va * VectorT::LoadUnaligned(x.data() + i)).StoreUnaligned(result.data() + i);
+			}
+			return result;
+		}
+
+		// Invokes the given function object with the std::type_identity of the
+		// widest packet type whose width divides N at the active SIMD level
+		// (see GetSIMDLevel). Returns false if there is no such packet type.
+		template< typename T, std::size_t N, typename FunctionT >
+		inline bool DispatchGradientPacket(FunctionT&& function) noexcept {
+			const SIMDLevel level = GetSIMDLevel();
+			#ifdef MAML_HAS_AVX2_VECTORS
+			if (SIMDLevel::AVX2 <= level) {
+				if constexpr (std::is_same_v< F32, T > && 0u == N % 8u) {
+					function(std::type_identity< F32x8S >());
+					return true;
+				}
+				if constexpr (std::is_same_v< F64, T > && 0u == N % 4u) {
+					function(std::type_identity< F64x4S >());
+					return true;
+				}
+			}
+			#endif
+			if constexpr (std::is_same_v< F32, T > && 0u == N % 4u) {
+				if (SIMDLevel::SSE2 <= level) {
+					function(std::type_identity< F32x4S >());
+					return true;
+				}
+			}
+			return false;
+		}
+
+		template< typename T, std::size_t N >
+		[[nodiscard]]
+		constexpr const Array< T, N > LinearCombination(T a, const Array< T, N >& x,
+														T b, const Array< T, N >& y) noexcept {
+			Array< T, N > result;
+			if (!std::is_constant_evaluated()) {
+				const bool packet = DispatchGradientPacket< T, N >([&](auto type) noexcept {
+					using VectorT = typename decltype(type)::type;
+					result = PacketLinearCombination< VectorT >(a, x, b, y);
+				});
+				if (packet) {
+					return result;
+				}
+			}
+
+			for (std::size_t i = 0u; i < N; ++i) {
+				result[i] = a * x[i] + b * y[i];
+			}
+			return result;
+		}
+
+		template< typename T, std::size_t N >
+		[[nodiscard]]
+		constexpr const Array< T, N > Scale(T a, const Array< T, N >& x) noexcept {
+			Array< T, N > result;
+			if (!std::is_constant_evaluated()) {
+				const bool packet = DispatchGradientPacket< T, N >([&](auto type) noexcept {
+					using VectorT = typename decltype(type)::type;
+					result = PacketScale< VectorT >(a, x);
+				});
+				if (packet) {
+					return result;
+				}
+			}
+
+			for (std::size_t i = 0u; i < N; ++i) {
+				result[i] = a * x[i];
+			}
+			return result;
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// GradientDual
+	//-------------------------------------------------------------------------
+
+	/**
+	 A dual number (Re, Du) with a real part and N infinitesimal parts: one
+	 evaluation of a function on GradientDual variables yields the function
+	 value and its gradient with respect to all N variables (multi-directional
+	 forward-mode automatic differentiation).
+
+	 For F32 (N a multiple of 4 or 8) and F64 (N a multiple of 4, at the AVX2
+	 level), the infinitesimal parts are updated with SIMD packets at runtime
+	 (see GetSIMDLevel).
+
+	 N must be larger than one (as for Array): use Dual for a single variable.
+	 */
+	template< typename T, std::size_t N,
+		      typename = std::enable_if_t< std::is_floating_point_v< T > > >
+	struct GradientDual {
+
+		static_assert(1u < N, "GradientDual requires N > 1: use Dual< T > for a single variable.");
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a constant (all infinitesimal parts are zero).
+		 */
+		constexpr explicit GradientDual(T x = T(0)) noexcept
+			: m_re(x), m_du() {}
+
+		constexpr GradientDual(T x, const Array< T, N >& y) noexcept
+			: m_re(x), m_du(y) {}
+
+		constexpr GradientDual(const GradientDual& v) noexcept = default;
+
+		constexpr GradientDual(GradientDual&& v) noexcept = default;
+
+		template< typename U >
+		constexpr explicit GradientDual(const GradientDual< U, N >& v) noexcept
+			: GradientDual(static_cast< T >(v.Re()),
+						   Array< T, N >(v.Du())) {}
+
+		~GradientDual() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		GradientDual& operator=(const GradientDual& v) noexcept = default;
+
+		GradientDual& operator=(GradientDual&& v) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Factory Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs the variable with the given index and value (i.e. the
+		 infinitesimal part is the unit vector along the given index).
+
+		 @pre			@a index is smaller than N.
+		 */
+		[[nodiscard]]
+		static constexpr const GradientDual Variable(T x, std::size_t index) noexcept {
+			GradientDual v(x);
+			v.m_du[index] = T(1);
+			return v;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		T& Re() noexcept {
+			return m_re;
+		}
+
+		[[nodiscard]]
+		constexpr const T Re() const noexcept {
+			return m_re;
+		}
+
+		[[nodiscard]]
+		Array< T, N >& Du() noexcept {
+			return m_du;
+		}
+
+		[[nodiscard]]
+		constexpr const Array< T, N >& Du() const noexcept {
+			return m_du;
+		}
+
+		[[nodiscard]]
+		constexpr const GradientDual operator+() const noexcept {
+			// +(Re, Du) = (Re, Du)
+			return *this;
+		}
+
+		[[nodiscard]]
+		constexpr const GradientDual operator-() const noexcept {
+			// -(Re, Du) = (-Re, -Du)
+			return { -Re(), details::Scale(T(-1), Du()) };
+		}
+
+		[[nodiscard]]
+		constexpr const GradientDual operator+(const GradientDual& v) const noexcept {
+			// (Re, Du) + (v.Re, v.Du) = (Re + v.Re, Du + v.Du)
+			return {
+				Re() + v.Re(),
+				details::LinearCombination(T(1), Du(), T(1), v.Du())
+			};
+		}
+
+		[[nodiscard]]
+		constexpr const GradientDual operator-(const GradientDual& v) const noexcept {
+			// (Re, Du) - (v.Re, v.Du) = (Re - v.Re, Du - v.Du)
+			return {
+				Re() - v.Re(),
+				details::LinearCombination(T(1), Du(), T(-1), v.Du())
+			};
+		}
+
+		[[nodiscard]]
+		constexpr const GradientDual operator*(const GradientDual& v) const noexcept {
+			// (Re, Du) * (v.Re, v.Du) = (Re * v.Re, Re * v.Du + Du * v.Re)
+			return {
+				Re() * v.Re(),
+				details::LinearCombination(Re(), v.Du(), v.Re(), Du())
+			};
+		}
+
+		[[nodiscard]]
+		constexpr const GradientDual operator/(const GradientDual& v) const noexcept {
+			// (Re, Du) / (v.Re, v.Du) = (Re / v.Re,
+			//                            (Du * v.Re - Re * v.Du) / v.Re^2)
+			const T inv_Re = T(1) / v.Re();
+			const T re     = inv_Re * Re();
+			return {
+				re,
+				details::LinearCombination(inv_Re, Du(), -re * inv_Re, v.Du())
+			};
+		}
+
+		[[nodiscard]]
+		constexpr const GradientDual operator+(T a) const noexcept {
+			// (Re, Du) + (a, 0) = (Re + a, Du)
+			return { Re() + a, Du() };
+		}
+
+		[[nodiscard]]
+		constexpr const GradientDual operator-(T a) const noexcept {
+			// (Re, Du) - (a, 0) = (Re - a, Du)
+			return { Re() - a, Du() };
+		}
+
+		[[nodiscard]]
+		constexpr const GradientDual operator*(T a) const noexcept {
+			// (Re, Du) * (a, 0) = (Re * a, Du * a)
+			return { Re() * a, details::Scale(a, Du()) };
+		}
+
+		[[nodiscard]]
+		constexpr const GradientDual operator/(T a) const noexcept {
+			// (Re, Du) / (a, 0) = (Re / a, Du / a)
+			const T inv_a = T(1) / a;
+			return { Re() * inv_a, details::Scale(inv_a, Du()) };
+		}
+
+		GradientDual& operator+=(const GradientDual& v) noexcept {
+			return *this = *this + v;
+		}
+
+		GradientDual& operator-=(const GradientDual& v) noexcept {
+			return *this = *this - v;
+		}
+
+		GradientDual& operator*=(const GradientDual& v) noexcept {
+			return *this = *this * v;
+		}
+
+		GradientDual& operator/=(const GradientDual& v) noexcept {
+			return *this = *this / v;
+		}
+
+		GradientDual& operator+=(T a) noexcept {
+			// (Re, Du) + (a, 0) = (Re + a, Du)
+			Re() += a;
+			return *this;
+		}
+
+		GradientDual& operator-=(T a) noexcept {
+			// (Re, Du) - (a, 0) = (Re - a, Du)
+			Re() -= a;
+			return *this;
+		}
+
+		GradientDual& operator*=(T a) noexcept {
+			return *this = *this * a;
+		}
+
+		GradientDual& operator/=(T a) noexcept {
+			return *this = *this / a;
+		}
+
+		[[nodiscard]]
+		constexpr bool operator==(const GradientDual& v) const {
+			return Re() == v.Re() && Du() == v.Du();
+		}
+
+		[[nodiscard]]
+		constexpr bool operator!=(const GradientDual& v) const {
+			return !(*this == v);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		T m_re;
+		Array< T, N > m_du;
+	};
+
+	template< typename T, std::size_t N >
+	[[nodiscard]]
+	constexpr const GradientDual< T, N > operator+(T a, const GradientDual< T, N >& v) noexcept {
+		// (a, 0) + (v.Re, v.Du) = (a + v.Re, v.Du)
+		return v + a;
+	}
+
+	template< typename T, std::size_t N >
+	[[nodiscard]]
+	constexpr const GradientDual< T, N > operator-(T a, const GradientDual< T, N >& v) noexcept {
+		// (a, 0) - (v.Re, v.Du) = (a - v.Re, -v.Du)
+		return -v + a;
+	}
+
+	template< typename T, std::size_t N >
+	[[nodiscard]]
+	constexpr const GradientDual< T, N > operator*(T a, const GradientDual< T, N >& v) noexcept {
+		// (a, 0) * (v.Re, v.Du) = (a * v.Re, a * v.Du)
+		return v * a;
+	}
+
+	template< typename T, std::size_t N >
+	[[nodiscard]]
+	constexpr const GradientDual< T, N > operator/(T a, const GradientDual< T, N >& v) noexcept {
+		// (a, 0) / (v.Re, v.Du) = (a / v.Re, (-a * v.Du) / v.Re^2)
+		const T inv = T(1) / v.Re();
+		return { inv * a, details::Scale(-a * inv * inv, v.Du()) };
+	}
+
+	//-------------------------------------------------------------------------
+	// Elementary Functions
+	//-------------------------------------------------------------------------
+
+	// f(Re, Du) = (f(Re), f'(Re) Du)
+	//
+	// All functions are constexpr (see constexpr\math.hpp).
+
+	template< typename T, std::size_t N >
+	[[nodiscard]]
+	constexpr const GradientDual< T, N > Exp(const GradientDual< T, N >& v) noexcept {
+		const T exp = Exp(v.Re());
+		return { exp, details::Scale(exp, v.Du()) };
+	}
+
+	template< typename T, std::size_t N >
+	[[nodiscard]]
+	constexpr const GradientDual< T, N > Ln(const GradientDual< T, N >& v) noexcept {
+		return { Ln(v.Re()), details::Scale(T(1) / v.Re(), v.Du()) };
+	}
+
+	template< typename T, std::size_t N >
+	[[nodiscard]]
+	constexpr const GradientDual< T, N > Sqrt(const GradientDual< T, N >& v) noexcept {
+		const T sqrt = Sqrt(v.Re());
+		return { sqrt, details::Scale(T(0.5) / sqrt, v.Du()) };
+	}
+
+	template< typename T, std::size_t N >
+	[[nodiscard]]
+	constexpr const GradientDual< T, N > Pow(const GradientDual< T, N >& v, T exponent) noexcept {
+		// d(x^a) = a x^(a-1) dx
+		const T pow = Pow(v.Re(), exponent - T(1));
+		return { Pow(v.Re(), exponent), details::Scale(exponent * pow, v.Du()) };
+	}
+
+	template< typename T, std::size_t N >
+	[[nodiscard]]
+	constexpr const GradientDual< T, N > Pow(const GradientDual< T, N >& v,
+											 const GradientDual< T, N >& exponent) noexcept {
+		// d(x^y) = y x^(y-1) dx + x^y ln(x) dy
+		// The second term is only added if dy != 0, since ln(x) is NaN for
+		// x < 0.
+		const GradientDual< T, N > pow = Pow(v, exponent.Re());
+		if (Array< T, N >() == exponent.Du()) {
+			return pow;
+		}
+
+		const T dx = exponent.Re() * Pow(v.Re(), exponent.Re() - T(1));
+		return {
+			pow.Re(),
+			details::LinearCombination(dx, v.Du(), pow.Re() * Ln(v.Re()), exponent.Du())
+		};
+	}
+
+	template< typename T, std::size_t N >
+	[[nodiscard]]
+	constexpr const GradientDual< T, N > Sin(const GradientDual< T, N >& v) noexcept {
+		const auto [sin, cos] = SinCos(v.Re());
+		return { sin, details::Scale(cos, v.Du()) };
+	}
+
+	template< typename T, std::size_t N >
+	[[nodiscard]]
+	constexpr const GradientDual< T, N > Cos(const GradientDual< T, N >& v) noexcept {
+		const auto [sin, cos] = SinCos(v.Re());
+		return { cos, details::Scale(-sin, v.Du()) };
+	}
+
+	template< typename T, std::size_t N >
+	[[nodiscard]]
+	constexpr const GradientDual< T, N > Atan2(const GradientDual< T, N >& y,
+											   const GradientDual< T, N >& x) noexcept {
+		// d(atan2(y, x)) = (x dy - y dx) / (x^2 + y^2)
+		const T inv = T(1) / (x.Re() * x.Re() + y.Re() * y.Re());
+		return {
+			Atan2(y.Re(), x.Re()),
+			details::LinearCombination(x.Re() * inv, y.Du(), -y.Re() * inv, x.Du())
+		};
+	}
+
+	//-------------------------------------------------------------------------
+	// Type Declarations and Definitions
+	//-------------------------------------------------------------------------
+
+	template< std::size_t N >
+	using GD32 = GradientDual< F32, N >;
+	template< std::size_t N >
+	using GD64 = GradientDual< F64, N >;
+}
@@ -0,0 +1,461 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "constexpr\math.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	//-------------------------------------------------------------------------
+	// HyperDual
+	//-------------------------------------------------------------------------
+
+	/**
+	 A hyper-dual number Re + E1 e1 + E2 e2 + E12 e1 e2 with e1^2 = e2^2 = 0
+	 and e1 e2 != 0. Evaluating f(x + a e1 + b e2 + 0 e1 e2) yields
+	 (f(x), a f'(x), b f'(x), a b f''(x)) without truncation error, so one
+	 evaluation of a function of several variables yields the value, two
+	 directional derivatives and the mixed second derivative (e.g. one
+	 Hessian entry or, with seeded directions, a Hessian-vector product
+	 component).
+	 */
+	template< typename T,
+		      typename = std::enable_if_t< IsScalarLike< T >::value > >
+	struct HyperDual : public Array< T, 4u > {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		constexpr explicit HyperDual(T x = T(0)) noexcept
+			: HyperDual(x, T(0), T(0), T(0)) {}
+
+		constexpr HyperDual(T x, T y, T z, T w) noexcept
+			: Array< T, 4u >(x, y, z, w) {}
+
+		constexpr HyperDual(const HyperDual& v) noexcept = default;
+
+		constexpr HyperDual(HyperDual&& v) noexcept = default;
+
+		template< typename U >
+		constexpr explicit HyperDual(const HyperDual< U >& v) noexcept
+			: HyperDual(static_cast< T >(v.Re()),
+						static_cast< T >(v.E1()),
+						static_cast< T >(v.E2()),
+						static_cast< T >(v.E12())) {}
+
+		~HyperDual() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		HyperDual& operator=(const HyperDual& v) noexcept = default;
+
+		HyperDual& operator=(HyperDual&& v) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		T& Re() noexcept {
+			return (*this)[0u];
+		}
+
+		[[nodiscard]]
+		constexpr const T Re() const noexcept {
+			return (*this)[0u];
+		}
+
+		[[nodiscard]]
+		T& E1() noexcept {
+			return (*this)[1u];
+		}
+
+		[[nodiscard]]
+		constexpr const T E1() const noexcept {
+			return (*this)[1u];
+		}
+
+		[[nodiscard]]
+		T& E2() noexcept {
+			return (*this)[2u];
+		}
+
+		[[nodiscard]]
+		constexpr const T E2() const noexcept {
+			return (*this)[2u];
+		}
+
+		[[nodiscard]]
+		T& E12() noexcept {
+			return (*this)[3u];
+		}
+
+		[[nodiscard]]
+		constexpr const T E12() const noexcept {
+			return (*this)[3u];
+		}
+
+		[[nodiscard]]
+		constexpr const HyperDual operator+() const noexcept {
+			// +(Re, E1, E2, E12) = (Re, E1, E2, E12)
+			return *this;
+		}
+
+		[[nodiscard]]
+		constexpr const HyperDual operator-() const noexcept {
+			// -(Re, E1, E2, E12) = (-Re, -E1, -E2, -E12)
+			return { -Re(), -E1(), -E2(), -E12() };
+		}
+
+		[[nodiscard]]
+		constexpr const HyperDual operator+(const HyperDual& v) const noexcept {
+			// (Re, E1, E2, E12) + (v.Re, v.E1, v.E2, v.E12)
+			// = (Re + v.Re, E1 + v.E1, E2 + v.E2, E12 + v.E12)
+			return { Re() + v.Re(), E1() + v.E1(), E2() + v.E2(), E12() + v.E12() };
+		}
+
+		[[nodiscard]]
+		constexpr const HyperDual operator-(const HyperDual& v) const noexcept {
+			// (Re, E1, E2, E12) - (v.Re, v.E1, v.E2, v.E12)
+			// = (Re - v.Re, E1 - v.E1, E2 - v.E2, E12 - v.E12)
+			return { Re() - v.Re(), E1() - v.E1(), E2() - v.E2(), E12() - v.E12() };
+		}
+
+		[[nodiscard]]
+		constexpr const HyperDual operator*(const HyperDual& v) const noexcept {
+			// (Re, E1, E2, E12) * (v.Re, v.E1, v.E2, v.E12)
+			// = (Re * v.Re,
+			//    Re * v.E1 + E1 * v.Re,
+			//    Re * v.E2 + E2 * v.Re,
+			//    Re * v.E12 + E1 * v.E2 + E2 * v.E1 + E12 * v.Re)
+			return {
+				Re() * v.Re(),
+				Re() * v.E1() + E1() * v.Re(),
+				Re() * v.E2() + E2() * v.Re(),
+				Re() * v.E12() + E1() * v.E2() + E2() * v.E1() + E12() * v.Re()
+			};
+		}
+
+		[[nodiscard]]
+		constexpr const HyperDual operator/(const HyperDual& v) const noexcept {
+			// (Re, E1, E2, E12) / (v.Re, v.E1, v.E2, v.E12)
+			// = (Re, E1, E2, E12) * 1 / (v.Re, v.E1, v.E2, v.E12)
+			//
+			// 1 / (v.Re, v.E1, v.E2, v.E12)
+			// = (1 / v.Re, -v.E1 / v.Re^2, -v.E2 / v.Re^2,
+			//    -v.E12 / v.Re^2 + 2 v.E1 v.E2 / v.Re^3)
+			const T inv  = T(1) / v.Re();
+			const T inv2 = inv * inv;
+			const HyperDual rcp = {
+				inv,
+				-v.E1() * inv2,
+				-v.E2() * inv2,
+				(T(2) * inv * v.E1() * v.E2() - v.E12()) * inv2
+			};
+			return *this * rcp;
+		}
+
+		[[nodiscard]]
+		constexpr const HyperDual operator+(T a) const noexcept {
+			// (Re, E1, E2, E12) + (a, 0, 0, 0) = (Re + a, E1, E2, E12)
+			return { Re() + a, E1(), E2(), E12() };
+		}
+
+		[[nodiscard]]
+		constexpr const HyperDual operator-(T a) const noexcept {
+			// (Re, E1, E2, E12) - (a, 0, 0, 0) = (Re - a, E1, E2, E12)
+			return { Re() - a, E1(), E2(), E12() };
+		}
+
+		[[nodiscard]]
+		constexpr const HyperDual operator*(T a) const noexcept {
+			// (Re, E1, E2, E12) * (a, 0, 0, 0) = (Re * a, E1 * a, E2 * a, E12 * a)
+			return { Re() * a, E1() * a, E2() * a, E12() * a };
+		}
+
+		[[nodiscard]]
+		constexpr const HyperDual operator/(T a) const noexcept {
+			// (Re, E1, E2, E12) / (a, 0, 0, 0) = (Re / a, E1 / a, E2 / a, E12 / a)
+			const T inv_a = T(1) / a;
+			return { Re() * inv_a, E1() * inv_a, E2() * inv_a, E12() * inv_a };
+		}
+
+		HyperDual& operator+=(const HyperDual& v) noexcept {
+			return *this = *this + v;
+		}
+
+		HyperDual& operator-=(const HyperDual& v) noexcept {
+			return *this = *this - v;
+		}
+
+		HyperDual& operator*=(const HyperDual& v) noexcept {
+			return *this = *this * v;
+		}
+
+		HyperDual& operator/=(const HyperDual& v) noexcept {
+			return *this = *this / v;
+		}
+
+		HyperDual& operator+=(T a) noexcept {
+			// (Re, E1, E2, E12) + (a, 0, 0, 0) = (Re + a, E1, E2, E12)
+			Re() += a;
+			return *this;
+		}
+
+		HyperDual& operator-=(T a) noexcept {
+			// (Re, E1, E2, E12) - (a, 0, 0, 0) = (Re - a, E1, E2, E12)
+			Re() -= a;
+			return *this;
+		}
+
+		HyperDual& operator*=(T a) noexcept {
+			return *this = *this * a;
+		}
+
+		HyperDual& operator/=(T a) noexcept {
+			return *this = *this / a;
+		}
+
+		[[nodiscard]]
+		constexpr bool operator==(const HyperDual& v) const {
+			if constexpr (std::is_floating_point_v< T >) {
+				return Re() == v.Re() && E1() == v.E1()
+					&& E2() == v.E2() && E12() == v.E12();
+			}
+			else {
+				return All((Re() == v.Re()) & (E1() == v.E1())
+						 & (E2() == v.E2()) & (E12() == v.E12()));
+			}
+		}
+
+		[[nodiscard]]
+		constexpr bool operator!=(const HyperDual& v) const {
+			return !(*this == v);
+		}
+	};
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const HyperDual< T > operator+(T a, const HyperDual< T >& v) noexcept {
+		// (a, 0, 0, 0) + (v.Re, v.E1, v.E2, v.E12) = (a + v.Re, v.E1, v.E2, v.E12)
+		return v + a;
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const HyperDual< T > operator-(T a, const HyperDual< T >& v) noexcept {
+		// (a, 0, 0, 0) - (v.Re, v.E1, v.E2, v.E12) = (a - v.Re, -v.E1, -v.E2, -v.E12)
+		return -v + a;
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const HyperDual< T > operator*(T a, const HyperDual< T >& v) noexcept {
+		// (a, 0, 0, 0) * (v.Re, v.E1, v.E2, v.E12)
+		// = (a * v.Re, a * v.E1, a * v.E2, a * v.E12)
+		return v * a;
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const HyperDual< T > operator/(T a, const HyperDual< T >& v) noexcept {
+		return HyperDual< T >(a) / v;
+	}
+
+	//-------------------------------------------------------------------------
+	// Elementary Functions
+	//-------------------------------------------------------------------------
+
+	namespace details {
+
+		// f(Re, E1, E2, E12)
+		// = (f(Re), f'(Re) E1, f'(Re) E2, f'(Re) E12 + f''(Re) E1 E2)
+		template< typename T >
+		[[nodiscard]]
+		constexpr const HyperDual< T > Apply(const HyperDual< T >& v,
+											 T f, T df, T ddf) noexcept {
+			return {
+				f,
+				df * v.E1(),
+				df * v.E2(),
+				df * v.E12() + ddf * v.E1() * v.E2()
+			};
+		}
+
+		// c x^a, or zero where c is zero (the derivatives of x^0 and x^1
+		// vanish even where x^(a-1) or x^(a-2) is infinite).
+		template< typename T >
+		[[nodiscard]]
+		constexpr const T ScaledPow(T c, T x, T a) noexcept {
+			if constexpr (std::is_floating_point_v< T >) {
+				return (T(0) == c) ? T(0) : c * maml::Pow(x, a);
+			}
+			else {
+				return Select(T(0) == c, T(0), c * Pow(x, a));
+			}
+		}
+	}
+
+	// Exp, Ln, Sqrt, Pow, Sin, Cos and Atan2 are constexpr for floating
+	// points (see constexpr\math.hpp).
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const HyperDual< T > Exp(const HyperDual< T >& v) noexcept {
+		const T exp = Exp(v.Re());
+		return details::Apply(v, exp, exp, exp);
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const HyperDual< T > Ln(const HyperDual< T >& v) noexcept {
+		const T inv = T(1) / v.Re();
+		return details::Apply(v, Ln(v.Re()), inv, -inv * inv);
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const HyperDual< T > Sqrt(const HyperDual< T >& v) noexcept {
+		// sqrt'(x) = 1 / (2 sqrt(x)), sqrt''(x) = -sqrt'(x) / (2 x)
+		const T sqrt = Sqrt(v.Re());
+		const T df   = T(0.5f) / sqrt;
+		return details::Apply(v, sqrt, df, -T(0.5f) * df / v.Re());
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const HyperDual< T > Pow(const HyperDual< T >& v, T exponent) noexcept {
+		// (x^a)' = a x^(a-1), (x^a)'' = a (a-1) x^(a-2)
+		const T a = exponent;
+		return details::Apply(v,
+							  details::ScaledPow(T(1), v.Re(), a),
+							  details::ScaledPow(a, v.Re(), a - T(1)),
+							  details::ScaledPow(a * (a - T(1)), v.Re(), a - T(2)));
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const HyperDual< T > Pow(const HyperDual< T >& v,
+									   const HyperDual< T >& exponent) noexcept {
+		// x^y is x^b for the real part b of y, plus the terms of a varying y:
+		// d/dy x^y = x^y ln(x), d^2/dy^2 x^y = x^y ln(x)^2 and
+		// d^2/dxdy x^y = x^(y-1) (1 + y ln(x)). These are only added where
+		// y varies, since ln(x) is NaN for x < 0.
+		const T b = exponent.Re();
+		const HyperDual< T > pow = Pow(v, b);
+		const auto varying = [&]() noexcept -> HyperDual< T > {
+			const T ln  = Ln(v.Re());
+			const T fy  = pow.Re() * ln;
+			const T fxy = Pow(v.Re(), b - T(1)) * (T(1) + b * ln);
+			return {
+				pow.Re(),
+				pow.E1() + fy * exponent.E1(),
+				pow.E2() + fy * exponent.E2(),
+				pow.E12() + fy * exponent.E12()
+					+ fy * ln * exponent.E1() * exponent.E2()
+					+ fxy * (v.E1() * exponent.E2() + exponent.E1() * v.E2())
+			};
+		};
+
+		if constexpr (std::is_floating_point_v< T >) {
+			const bool constant = T(0) == exponent.E1() && T(0) == exponent.E2()
+							   && T(0) == exponent.E12();
+			return constant ? pow : varying();
+		}
+		else {
+			const auto constant = (T(0) == exponent.E1()) & (T(0) == exponent.E2())
+								& (T(0) == exponent.E12());
+			const HyperDual< T > r = varying();
+			return {
+				pow.Re(),
+				Select(constant, pow.E1(), r.E1()),
+				Select(constant, pow.E2(), r.E2()),
+				Select(constant, pow.E12(), r.E12())
+			};
+		}
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const HyperDual< T > Sin(const HyperDual< T >& v) noexcept {
+		const auto [sin, cos] = SinCos(v.Re());
+		return details::Apply(v, sin, cos, -sin);
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const HyperDual< T > Cos(const HyperDual< T >& v) noexcept {
+		const auto [sin, cos] = SinCos(v.Re());
+		return details::Apply(v, cos, -sin, -cos);
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const HyperDual< T > Atan2(const HyperDual< T >& y,
+										 const HyperDual< T >& x) noexcept {
+		// With r^2 = x^2 + y^2:
+		// d/dy = x / r^2,  d/dx = -y / r^2,
+		// d^2/dy^2 = -2xy / r^4 = -d^2/dx^2, d^2/dxdy = (y^2 - x^2) / r^4
+		const T inv_r2 = T(1) / (x.Re() * x.Re() + y.Re() * y.Re());
+		const T fy     = x.Re() * inv_r2;
+		const T fx     = -y.Re() * inv_r2;
+		const T fyy    = T(2) * fy * fx;
+		const T fxy    = (y.Re() * y.Re() - x.Re() * x.Re()) * inv_r2 * inv_r2;
+
+		return {
+			Atan2(y.Re(), x.Re()),
+			fy * y.E1() + fx * x.E1(),
+			fy * y.E2() + fx * x.E2(),
+			fy * y.E12() + fx * x.E12()
+				+ fyy * (y.E1() * y.E2() - x.E1() * x.E2())
+				+ fxy * (y.E1() * x.E2() + x.E1() * y.E2())
+		};
+	}
+
+	//-------------------------------------------------------------------------
+	// Type Declarations and Definitions
+	//-------------------------------------------------------------------------
+
+	using HD32 = HyperDual< F32 >;
+	using HD64 = HyperDual< F64 >;
+
+	static_assert(sizeof(HD32) == sizeof(F32x4));
+	static_assert(sizeof(HD64) == sizeof(F64x4));
+}
+
+namespace std {
+
+	template< typename T >
+	struct tuple_size< maml::HyperDual< T > >
+		: public integral_constant< std::size_t, 4u > {};
+
+	template< std::size_t I, typename T >
+	struct tuple_element< I, maml::HyperDual< T > > {
+
+	public:
+
+		using type = T;
+	};
+}
@@ -5,7 +5,16 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "constexpr\math.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
 
 #pragma endregion
 
@@ -19,7 +28,7 @@ namespace maml {
 	//-------------------------------------------------------------------------
 
 	template< typename T, 
-		      typename = std::enable_if_t< std::is_floating_point_v< T > > >
+		      typename = std::enable_if_t< IsScalarLike< T >::value > >
 	struct Hyperbolic : public Array< T, 2u > {
 
 	public:
@@ -45,6 +54,16 @@ namespace maml {
 		
 		~Hyperbolic() = default;
 
+		/**
+		 Constructs the Lorentz boost (cosh(rapidity), sinh(rapidity)) with
+		 the given rapidity. Boosts act on events (t, x) by multiplication,
+		 and compose by multiplication (i.e. their rapidities add).
+		 */
+		[[nodiscard]]
+		static constexpr const Hyperbolic FromRapidity(T rapidity) noexcept {
+			return { Cosh(rapidity), Sinh(rapidity) };
+		}
+
 		//---------------------------------------------------------------------
 		// Assignment Operators
 		//---------------------------------------------------------------------
@@ -153,9 +172,7 @@ namespace maml {
 		Hyperbolic& operator*=(const Hyperbolic& v) noexcept {
 			// (Re, Im) * (v.Re, v.Im) = (Re * v.Re + Im * v.Im, 
 			//                            Re * v.Im + Im * v.Re)
-			Re() = Re() * v.Re() + Im() * v.Im();
-			Im() = Re() * v.Im() + Im() * v.Re();
-			return *this;
+			return *this = *this * v;
 		}
 
 		Hyperbolic& operator+=(T a) noexcept {
@@ -187,7 +204,12 @@ namespace maml {
 
 		[[nodiscard]]
 		constexpr bool operator==(const Hyperbolic& v) const {
-			return Re() == v.Re() && Im() == v.Im();
+			if constexpr (std::is_floating_point_v< T >) {
+				return Re() == v.Re() && Im() == v.Im();
+			}
+			else {
+				return All((Re() == v.Re()) & (Im() == v.Im()));
+			}
 		}
 		
 		[[nodiscard]]
@@ -204,6 +226,33 @@ namespace maml {
 		constexpr const T Modulus() const noexcept {
 			return Re() * Re() - Im() * Im();
 		}
+
+		/**
+		 Returns the rapidity atanh(Im / Re) of this boost.
+
+		 @pre			This hyperbolic number has a positive modulus and a
+						positive real part.
+		 */
+		[[nodiscard]]
+		constexpr const T Rapidity() const noexcept {
+			// atanh(Im / Re) = ln((Re + Im) / (Re - Im)) / 2
+			if constexpr (std::is_floating_point_v< T >) {
+				return Atanh(Im() / Re());
+			}
+			else {
+				return T(0.5f) * Log((Re() + Im()) / (Re() - Im()));
+			}
+		}
+
+		/**
+		 Scales this hyperbolic number to a unit modulus (e.g. to remove the
+		 drift of a long composition of boosts).
+
+		 @pre			This hyperbolic number has a positive modulus.
+		 */
+		constexpr Hyperbolic& Normalize() noexcept {
+			return *this = *this * (T(1) / Sqrt(Modulus()));
+		}
 	};
 
 	template< typename T >
@@ -216,8 +265,8 @@ namespace maml {
 	template< typename T >
 	[[nodiscard]]
 	constexpr const Hyperbolic< T > operator-(T a, const Hyperbolic< T >& v) noexcept {
-		// (a, 0) - (v.Re, v.Im) = (a - v.Re, v.Im)
-		return v - a;
+		// (a, 0) - (v.Re, v.Im) = (a - v.Re, -v.Im)
+		return -v + a;
 	}
 
 	template< typename T >
@@ -227,6 +276,33 @@ namespace maml {
 		return v * a;
 	}
 
+	//-------------------------------------------------------------------------
+	// Lorentz Boosts
+	//-------------------------------------------------------------------------
+
+	/**
+	 Composes the given boosts: applying the result is equivalent to applying
+	 @a first followed by @a second.
+	 */
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Hyperbolic< T > Compose(const Hyperbolic< T >& first,
+											const Hyperbolic< T >& second) noexcept {
+		// Multiplication of split-complex numbers is commutative.
+		return second * first;
+	}
+
+	/**
+	 Applies the given boost to the given event (t, x).
+	 */
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Hyperbolic< T > Boost(const Hyperbolic< T >& event,
+										  const Hyperbolic< T >& boost) noexcept {
+		// (cosh, sinh) * (t, x) = (cosh t + sinh x, cosh x + sinh t)
+		return boost * event;
+	}
+
 	//-------------------------------------------------------------------------
 	// Type Declarations and Definitions
 	//-------------------------------------------------------------------------
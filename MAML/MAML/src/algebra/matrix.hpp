@@ -0,0 +1,220 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	//-------------------------------------------------------------------------
+	// 4x4 Matrices
+	//-------------------------------------------------------------------------
+
+	// The matrices are stored in column-major order: m[c][r] is the element
+	// at row r and column c. These constexpr functions are the scalar twins
+	// of the F32x4x4S methods in simd\matrix.hpp.
+
+	template< typename T >
+	using Matrix4x4 = Array< Array< T, 4u >, 4u >;
+
+	/**
+	 Returns the 4x4 identity matrix.
+	 */
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Matrix4x4< T > Identity4x4() noexcept {
+		return {
+			Array< T, 4u >(T(1), T(0), T(0), T(0)),
+			Array< T, 4u >(T(0), T(1), T(0), T(0)),
+			Array< T, 4u >(T(0), T(0), T(1), T(0)),
+			Array< T, 4u >(T(0), T(0), T(0), T(1))
+		};
+	}
+
+	/**
+	 Multiplies the given matrix with the given column vector: m * v.
+	 */
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Array< T, 4u > Mul(const Matrix4x4< T >& m,
+									   const Array< T, 4u >& v) noexcept {
+		// m * v = m[0] * v.x + m[1] * v.y + m[2] * v.z + m[3] * v.w
+		Array< T, 4u > result;
+		for (std::size_t r = 0u; r < 4u; ++r) {
+			result[r] = m[0u][r] * v[0u] + m[1u][r] * v[1u]
+				      + m[2u][r] * v[2u] + m[3u][r] * v[3u];
+		}
+		return result;
+	}
+
+	/**
+	 Multiplies the given matrices: m1 * m2.
+	 */
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Matrix4x4< T > Mul(const Matrix4x4< T >& m1,
+									   const Matrix4x4< T >& m2) noexcept {
+		// (m1 * m2)[c] = m1 * m2[c]
+		return {
+			Mul(m1, m2[0u]), Mul(m1, m2[1u]), Mul(m1, m2[2u]), Mul(m1, m2[3u])
+		};
+	}
+
+	/**
+	 Transposes the given matrix.
+	 */
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Matrix4x4< T > Transpose(const Matrix4x4< T >& m) noexcept {
+		Matrix4x4< T > result;
+		for (std::size_t c = 0u; c < 4u; ++c) {
+			for (std::size_t r = 0u; r < 4u; ++r) {
+				result[c][r] = m[r][c];
+			}
+		}
+		return result;
+	}
+
+	namespace details {
+
+		// The 2x2 minors of the upper (s) and lower (c) two rows.
+		template< typename T >
+		struct Minors4x4 {
+
+		public:
+
+			Array< T, 6u > m_s;
+			Array< T, 6u > m_c;
+		};
+
+		template< typename T >
+		[[nodiscard]]
+		constexpr const Minors4x4< T > ComputeMinors(const Matrix4x4< T >& m) noexcept {
+			const auto a = [&m](std::size_t r, std::size_t c) noexcept {
+				return m[c][r];
+			};
+
+			Minors4x4< T > result;
+			result.m_s[0u] = a(0u, 0u) * a(1u, 1u) - a(1u, 0u) * a(0u, 1u);
+			result.m_s[1u] = a(0u, 0u) * a(1u, 2u) - a(1u, 0u) * a(0u, 2u);
+			result.m_s[2u] = a(0u, 0u) * a(1u, 3u) - a(1u, 0u) * a(0u, 3u);
+			result.m_s[3u] = a(0u, 1u) * a(1u, 2u) - a(1u, 1u) * a(0u, 2u);
+			result.m_s[4u] = a(0u, 1u) * a(1u, 3u) - a(1u, 1u) * a(0u, 3u);
+			result.m_s[5u] = a(0u, 2u) * a(1u, 3u) - a(1u, 2u) * a(0u, 3u);
+			result.m_c[0u] = a(2u, 0u) * a(3u, 1u) - a(3u, 0u) * a(2u, 1u);
+			result.m_c[1u] = a(2u, 0u) * a(3u, 2u) - a(3u, 0u) * a(2u, 2u);
+			result.m_c[2u] = a(2u, 0u) * a(3u, 3u) - a(3u, 0u) * a(2u, 3u);
+			result.m_c[3u] = a(2u, 1u) * a(3u, 2u) - a(3u, 1u) * a(2u, 2u);
+			result.m_c[4u] = a(2u, 1u) * a(3u, 3u) - a(3u, 1u) * a(2u, 3u);
+			result.m_c[5u] = a(2u, 2u) * a(3u, 3u) - a(3u, 2u) * a(2u, 3u);
+			return result;
+		}
+
+		template< typename T >
+		[[nodiscard]]
+		constexpr const T Determinant(const Minors4x4< T >& minors) noexcept {
+			const auto& s = minors.m_s;
+			const auto& c = minors.m_c;
+			return s[0u] * c[5u] - s[1u] * c[4u] + s[2u] * c[3u]
+				 + s[3u] * c[2u] - s[4u] * c[1u] + s[5u] * c[0u];
+		}
+	}
+
+	/**
+	 Computes the determinant of the given matrix.
+	 */
+	template< typename T >
+	[[nodiscard]]
+	constexpr const T Determinant(const Matrix4x4< T >& m) noexcept {
+		return details::Determinant(details::ComputeMinors(m));
+	}
+
+	/**
+	 Computes the inverse of the given matrix using the Laplace expansion
+	 theorem on the 2x2 minors.
+
+	 @pre			The given matrix is invertible.
+	 */
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Matrix4x4< T > Inverse(const Matrix4x4< T >& m) noexcept {
+		const auto a = [&m](std::size_t r, std::size_t c) noexcept {
+			return m[c][r];
+		};
+
+		const auto minors = details::ComputeMinors(m);
+		const auto& s = minors.m_s;
+		const auto& c = minors.m_c;
+		const T inv_det = T(1) / details::Determinant(minors);
+
+		Matrix4x4< T > result;
+		result[0u][0u] = ( a(1u, 1u) * c[5u] - a(1u, 2u) * c[4u] + a(1u, 3u) * c[3u]) * inv_det;
+		result[1u][0u] = (-a(0u, 1u) * c[5u] + a(0u, 2u) * c[4u] - a(0u, 3u) * c[3u]) * inv_det;
+		result[2u][0u] = ( a(3u, 1u) * s[5u] - a(3u, 2u) * s[4u] + a(3u, 3u) * s[3u]) * inv_det;
+		result[3u][0u] = (-a(2u, 1u) * s[5u] + a(2u, 2u) * s[4u] - a(2u, 3u) * s[3u]) * inv_det;
+		result[0u][1u] = (-a(1u, 0u) * c[5u] + a(1u, 2u) * c[2u] - a(1u, 3u) * c[1u]) * inv_det;
+		result[1u][1u] = ( a(0u, 0u) * c[5u] - a(0u, 2u) * c[2u] + a(0u, 3u) * c[1u]) * inv_det;
+		result[2u][1u] = (-a(3u, 0u) * s[5u] + a(3u, 2u) * s[2u] - a(3u, 3u) * s[1u]) * inv_det;
+		result[3u][1u] = ( a(2u, 0u) * s[5u] - a(2u, 2u) * s[2u] + a(2u, 3u) * s[1u]) * inv_det;
+		result[0u][2u] = ( a(1u, 0u) * c[4u] - a(1u, 1u) * c[2u] + a(1u, 3u) * c[0u]) * inv_det;
+		result[1u][2u] = (-a(0u, 0u) * c[4u] + a(0u, 1u) * c[2u] - a(0u, 3u) * c[0u]) * inv_det;
+		result[2u][2u] = ( a(3u, 0u) * s[4u] - a(3u, 1u) * s[2u] + a(3u, 3u) * s[0u]) * inv_det;
+		result[3u][2u] = (-a(2u, 0u) * s[4u] + a(2u, 1u) * s[2u] - a(2u, 3u) * s[0u]) * inv_det;
+		result[0u][3u] = (-a(1u, 0u) * c[3u] + a(1u, 1u) * c[1u] - a(1u, 2u) * c[0u]) * inv_det;
+		result[1u][3u] = ( a(0u, 0u) * c[3u] - a(0u, 1u) * c[1u] + a(0u, 2u) * c[0u]) * inv_det;
+		result[2u][3u] = (-a(3u, 0u) * s[3u] + a(3u, 1u) * s[1u] - a(3u, 2u) * s[0u]) * inv_det;
+		result[3u][3u] = ( a(2u, 0u) * s[3u] - a(2u, 1u) * s[1u] + a(2u, 2u) * s[0u]) * inv_det;
+		return result;
+	}
+
+	/**
+	 Computes the inverse of the given affine matrix.
+
+	 @pre			The given matrix is invertible and its last row is
+					(0, 0, 0, 1).
+	 */
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Matrix4x4< T > InverseAffine(const Matrix4x4< T >& m) noexcept {
+		// The rows of the inverse of the upper-left 3x3 block (m[0] m[1] m[2])
+		// are (m[1] x m[2], m[2] x m[0], m[0] x m[1]) / det.
+		const auto cross = [](const Array< T, 4u >& a, const Array< T, 4u >& b) noexcept {
+			return Array< T, 4u >(a[1u] * b[2u] - a[2u] * b[1u],
+								  a[2u] * b[0u] - a[0u] * b[2u],
+								  a[0u] * b[1u] - a[1u] * b[0u],
+								  T(0));
+		};
+
+		const Array< Array< T, 4u >, 3u > rows = {
+			cross(m[1u], m[2u]), cross(m[2u], m[0u]), cross(m[0u], m[1u])
+		};
+		const T inv_det = T(1) / (m[0u][0u] * rows[0u][0u]
+							    + m[0u][1u] * rows[0u][1u]
+							    + m[0u][2u] * rows[0u][2u]);
+
+		Matrix4x4< T > result;
+		for (std::size_t c = 0u; c < 3u; ++c) {
+			for (std::size_t r = 0u; r < 3u; ++r) {
+				result[c][r] = rows[r][c] * inv_det;
+			}
+			result[c][3u] = T(0);
+		}
+
+		// The translation of the inverse is -inverse(block) * m[3].
+		for (std::size_t r = 0u; r < 3u; ++r) {
+			result[3u][r] = -(result[0u][r] * m[3u][0u]
+							+ result[1u][r] * m[3u][1u]
+							+ result[2u][r] * m[3u][2u]);
+		}
+		result[3u][3u] = T(1);
+		return result;
+	}
+}
@@ -0,0 +1,418 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "algebra\matrix.hpp"
+#include "constexpr\math.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	//-------------------------------------------------------------------------
+	// Quaternion
+	//-------------------------------------------------------------------------
+
+	/**
+	 A quaternion (X, Y, Z, W) = W + X i + Y j + Z k with vector part
+	 (X, Y, Z) and real part W.
+	 */
+	template< typename T,
+		      typename = std::enable_if_t< std::is_floating_point_v< T > > >
+	struct Quaternion : public Array< T, 4u > {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		constexpr explicit Quaternion(T xyzw = T(0)) noexcept
+			: Quaternion(xyzw, xyzw, xyzw, xyzw) {}
+
+		constexpr Quaternion(T x, T y, T z, T w) noexcept
+			: Array< T, 4u >(x, y, z, w) {}
+
+		constexpr Quaternion(const Quaternion& v) noexcept = default;
+
+		constexpr Quaternion(Quaternion&& v) noexcept = default;
+
+		template< typename U >
+		constexpr explicit Quaternion(const Quaternion< U >& v) noexcept
+			: Quaternion(static_cast< T >(v.X()),
+				         static_cast< T >(v.Y()),
+				         static_cast< T >(v.Z()),
+				         static_cast< T >(v.W())) {}
+
+		~Quaternion() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		Quaternion& operator=(const Quaternion& v) noexcept = default;
+
+		Quaternion& operator=(Quaternion&& v) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Factory Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		static constexpr const Quaternion Identity() noexcept {
+			return { T(0), T(0), T(0), T(1) };
+		}
+
+		/**
+		 Constructs the rotation of the given angle (in radians) around the
+		 given normalized axis.
+		 */
+		[[nodiscard]]
+		static constexpr const Quaternion FromAxisAngle(const Array< T, 3u >& axis,
+														T angle) noexcept {
+			const auto [s, c] = SinCos(T(0.5) * angle);
+			return { s * axis[0u], s * axis[1u], s * axis[2u], c };
+		}
+
+		/**
+		 Constructs the rotation of the upper-left 3x3 block of the given
+		 (column-major) rotation matrix.
+		 */
+		[[nodiscard]]
+		static const Quaternion FromMatrix(const Matrix4x4< T >& m) noexcept {
+			// Shepperd's method: pivot on the largest diagonal element to
+			// avoid the cancellation for rotations close to 180 degrees.
+			const auto a = [&m](std::size_t r, std::size_t c) noexcept {
+				return m[c][r];
+			};
+
+			const T trace = a(0u, 0u) + a(1u, 1u) + a(2u, 2u);
+			if (T(0) < trace) {
+				const T s = T(0.5) / std::sqrt(trace + T(1));
+				return {
+					(a(2u, 1u) - a(1u, 2u)) * s,
+					(a(0u, 2u) - a(2u, 0u)) * s,
+					(a(1u, 0u) - a(0u, 1u)) * s,
+					T(0.25) / s
+				};
+			}
+			if (a(1u, 1u) < a(0u, 0u) && a(2u, 2u) < a(0u, 0u)) {
+				const T s = T(0.5) / std::sqrt(T(1) + a(0u, 0u) - a(1u, 1u) - a(2u, 2u));
+				return {
+					T(0.25) / s,
+					(a(0u, 1u) + a(1u, 0u)) * s,
+					(a(0u, 2u) + a(2u, 0u)) * s,
+					(a(2u, 1u) - a(1u, 2u)) * s
+				};
+			}
+			if (a(2u, 2u) < a(1u, 1u)) {
+				const T s = T(0.5) / std::sqrt(T(1) + a(1u, 1u) - a(0u, 0u) - a(2u, 2u));
+				return {
+					(a(0u, 1u) + a(1u, 0u)) * s,
+					T(0.25) / s,
+					(a(1u, 2u) + a(2u, 1u)) * s,
+					(a(0u, 2u) - a(2u, 0u)) * s
+				};
+			}
+
+			const T s = T(0.5) / std::sqrt(T(1) + a(2u, 2u) - a(0u, 0u) - a(1u, 1u));
+			return {
+				(a(0u, 2u) + a(2u, 0u)) * s,
+				(a(1u, 2u) + a(2u, 1u)) * s,
+				T(0.25) / s,
+				(a(1u, 0u) - a(0u, 1u)) * s
+			};
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		T& X() noexcept {
+			return (*this)[0u];
+		}
+
+		[[nodiscard]]
+		constexpr const T X() const noexcept {
+			return (*this)[0u];
+		}
+
+		[[nodiscard]]
+		T& Y() noexcept {
+			return (*this)[1u];
+		}
+
+		[[nodiscard]]
+		constexpr const T Y() const noexcept {
+			return (*this)[1u];
+		}
+
+		[[nodiscard]]
+		T& Z() noexcept {
+			return (*this)[2u];
+		}
+
+		[[nodiscard]]
+		constexpr const T Z() const noexcept {
+			return (*this)[2u];
+		}
+
+		[[nodiscard]]
+		T& W() noexcept {
+			return (*this)[3u];
+		}
+
+		[[nodiscard]]
+		constexpr const T W() const noexcept {
+			return (*this)[3u];
+		}
+
+		[[nodiscard]]
+		constexpr const Quaternion operator+() const noexcept {
+			// +(X, Y, Z, W) = (X, Y, Z, W)
+			return *this;
+		}
+
+		[[nodiscard]]
+		constexpr const Quaternion operator-() const noexcept {
+			// -(X, Y, Z, W) = (-X, -Y, -Z, -W)
+			return { -X(), -Y(), -Z(), -W() };
+		}
+
+		[[nodiscard]]
+		constexpr const Quaternion operator+(const Quaternion& v) const noexcept {
+			// (X, Y, Z, W) + (v.X, v.Y, v.Z, v.W)
+			// = (X + v.X, Y + v.Y, Z + v.Z, W + v.W)
+			return { X() + v.X(), Y() + v.Y(), Z() + v.Z(), W() + v.W() };
+		}
+
+		[[nodiscard]]
+		constexpr const Quaternion operator-(const Quaternion& v) const noexcept {
+			// (X, Y, Z, W) - (v.X, v.Y, v.Z, v.W)
+			// = (X - v.X, Y - v.Y, Z - v.Z, W - v.W)
+			return { X() - v.X(), Y() - v.Y(), Z() - v.Z(), W() - v.W() };
+		}
+
+		[[nodiscard]]
+		constexpr const Quaternion operator*(const Quaternion& v) const noexcept {
+			// (V, W) * (v.V, v.W) = (W * v.V + v.W * V + V x v.V,
+			//                        W * v.W - V . v.V)
+			return {
+				W() * v.X() + X() * v.W() + Y() * v.Z() - Z() * v.Y(),
+				W() * v.Y() - X() * v.Z() + Y() * v.W() + Z() * v.X(),
+				W() * v.Z() + X() * v.Y() - Y() * v.X() + Z() * v.W(),
+				W() * v.W() - X() * v.X() - Y() * v.Y() - Z() * v.Z()
+			};
+		}
+
+		[[nodiscard]]
+		constexpr const Quaternion operator/(const Quaternion& v) const noexcept {
+			// (V, W) / (v.V, v.W) = (V, W) * (v.V, v.W)^-1
+			return *this * v.Inverse();
+		}
+
+		[[nodiscard]]
+		constexpr const Quaternion operator+(T a) const noexcept {
+			// (X, Y, Z, W) + (0, 0, 0, a) = (X, Y, Z, W + a)
+			return { X(), Y(), Z(), W() + a };
+		}
+
+		[[nodiscard]]
+		constexpr const Quaternion operator-(T a) const noexcept {
+			// (X, Y, Z, W) - (0, 0, 0, a) = (X, Y, Z, W - a)
+			return { X(), Y(), Z(), W() - a };
+		}
+
+		[[nodiscard]]
+		constexpr const Quaternion operator*(T a) const noexcept {
+			// (X, Y, Z, W) * (0, 0, 0, a) = (X * a, Y * a, Z * a, W * a)
+			return { X() * a, Y() * a, Z() * a, W() * a };
+		}
+
+		[[nodiscard]]
+		constexpr const Quaternion operator/(T a) const noexcept {
+			// (X, Y, Z, W) / (0, 0, 0, a) = (X / a, Y / a, Z / a, W / a)
+			const T inv_a = T(1) / a;
+			return *this * inv_a;
+		}
+
+		Quaternion& operator+=(const Quaternion& v) noexcept {
+			return *this = *this + v;
+		}
+
+		Quaternion& operator-=(const Quaternion& v) noexcept {
+			return *this = *this - v;
+		}
+
+		Quaternion& operator*=(const Quaternion& v) noexcept {
+			return *this = *this * v;
+		}
+
+		Quaternion& operator/=(const Quaternion& v) noexcept {
+			return *this = *this / v;
+		}
+
+		Quaternion& operator+=(T a) noexcept {
+			// (X, Y, Z, W) + (0, 0, 0, a) = (X, Y, Z, W + a)
+			W() += a;
+			return *this;
+		}
+
+		Quaternion& operator-=(T a) noexcept {
+			// (X, Y, Z, W) - (0, 0, 0, a) = (X, Y, Z, W - a)
+			W() -= a;
+			return *this;
+		}
+
+		Quaternion& operator*=(T a) noexcept {
+			return *this = *this * a;
+		}
+
+		Quaternion& operator/=(T a) noexcept {
+			return *this = *this / a;
+		}
+
+		[[nodiscard]]
+		constexpr bool operator==(const Quaternion& v) const {
+			return X() == v.X() && Y() == v.Y() && Z() == v.Z() && W() == v.W();
+		}
+
+		[[nodiscard]]
+		constexpr bool operator!=(const Quaternion& v) const {
+			return !(*this == v);
+		}
+
+		[[nodiscard]]
+		constexpr const Quaternion Conjugate() const noexcept {
+			return { -X(), -Y(), -Z(), W() };
+		}
+
+		[[nodiscard]]
+		constexpr const Quaternion Inverse() const noexcept {
+			return Conjugate() / SqrAbs();
+		}
+
+		[[nodiscard]]
+		constexpr const T Norm() const noexcept {
+			return SqrAbs();
+		}
+
+		[[nodiscard]]
+		constexpr const T SqrAbs() const noexcept {
+			return X() * X() + Y() * Y() + Z() * Z() + W() * W();
+		}
+
+		[[nodiscard]]
+		constexpr const T Abs() const noexcept {
+			return Sqrt(SqrAbs());
+		}
+
+		Quaternion& Normalize() noexcept {
+			return *this *= T(1) / Abs();
+		}
+
+		/**
+		 Rotates the given vector by this (normalized) quaternion.
+		 */
+		[[nodiscard]]
+		constexpr const Array< T, 3u > Rotate(const Array< T, 3u >& v) const noexcept {
+			// t = 2 (V x v), v' = v + W t + V x t
+			const Array< T, 3u > t = {
+				T(2) * (Y() * v[2u] - Z() * v[1u]),
+				T(2) * (Z() * v[0u] - X() * v[2u]),
+				T(2) * (X() * v[1u] - Y() * v[0u])
+			};
+			return {
+				v[0u] + W() * t[0u] + (Y() * t[2u] - Z() * t[1u]),
+				v[1u] + W() * t[1u] + (Z() * t[0u] - X() * t[2u]),
+				v[2u] + W() * t[2u] + (X() * t[1u] - Y() * t[0u])
+			};
+		}
+
+		/**
+		 Converts this (normalized) quaternion to a column-major rotation
+		 matrix.
+		 */
+		[[nodiscard]]
+		constexpr const Matrix4x4< T > ToMatrix() const noexcept {
+			const T xx = X() * X(), yy = Y() * Y(), zz = Z() * Z();
+			const T xy = X() * Y(), xz = X() * Z(), yz = Y() * Z();
+			const T wx = W() * X(), wy = W() * Y(), wz = W() * Z();
+			return {
+				Array< T, 4u >(T(1) - T(2) * (yy + zz), T(2) * (xy + wz), T(2) * (xz - wy), T(0)),
+				Array< T, 4u >(T(2) * (xy - wz), T(1) - T(2) * (xx + zz), T(2) * (yz + wx), T(0)),
+				Array< T, 4u >(T(2) * (xz + wy), T(2) * (yz - wx), T(1) - T(2) * (xx + yy), T(0)),
+				Array< T, 4u >(T(0), T(0), T(0), T(1))
+			};
+		}
+	};
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Quaternion< T > operator+(T a, const Quaternion< T >& v) noexcept {
+		// (0, 0, 0, a) + (v.X, v.Y, v.Z, v.W) = (v.X, v.Y, v.Z, a + v.W)
+		return v + a;
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Quaternion< T > operator-(T a, const Quaternion< T >& v) noexcept {
+		// (0, 0, 0, a) - (v.X, v.Y, v.Z, v.W) = (-v.X, -v.Y, -v.Z, a - v.W)
+		return -v + a;
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Quaternion< T > operator*(T a, const Quaternion< T >& v) noexcept {
+		// (0, 0, 0, a) * (v.X, v.Y, v.Z, v.W) = (a * v.X, a * v.Y, a * v.Z, a * v.W)
+		return v * a;
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr const Quaternion< T > operator/(T a, const Quaternion< T >& v) noexcept {
+		// (0, 0, 0, a) / (v.X, v.Y, v.Z, v.W) = a * (v.X, v.Y, v.Z, v.W)^-1
+		return v.Inverse() * a;
+	}
+
+	//-------------------------------------------------------------------------
+	// Type Declarations and Definitions
+	//-------------------------------------------------------------------------
+
+	using Q32 = Quaternion< F32 >;
+	using Q64 = Quaternion< F64 >;
+
+	static_assert(sizeof(Q32) == sizeof(F32x4));
+	static_assert(sizeof(Q64) == sizeof(F64x4));
+}
+
+namespace std {
+
+	template< typename T >
+	struct tuple_size< maml::Quaternion< T > >
+		: public integral_constant< std::size_t, 4u > {};
+
+	template< std::size_t I, typename T >
+	struct tuple_element< I, maml::Quaternion< T > > {
+
+	public:
+
+		using type = T;
+	};
+}
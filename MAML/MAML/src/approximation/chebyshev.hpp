@@ -0,0 +1,128 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "constexpr\math.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+#include <numbers>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	//-------------------------------------------------------------------------
+	// Chebyshev Approximation
+	//-------------------------------------------------------------------------
+
+	/**
+	 Fits a polynomial of the given degree to the given function over
+	 [@a low, @a high] by interpolating at the Chebyshev nodes.
+
+	 The interpolant is near-minimax: its maximum error is within a small
+	 factor (below 4 for degrees up to 20) of the best uniform approximation.
+	 The function is a stateless function object type invoked with F64
+	 arguments (e.g. a lambda calling the constexpr functions of
+	 constexpr\math.hpp), and is only invoked at the Chebyshev nodes (which
+	 exclude the interval bounds).
+
+	 @pre			@a low is smaller than @a high.
+	 @return		The monomial coefficients c of the interpolant
+					p(x) = c[0] + c[1] x + ... + c[Degree] x^Degree.
+	 */
+	template< typename FunctionT, std::size_t Degree >
+	[[nodiscard]]
+	constexpr const std::array< F64, Degree + 1u > ChebyshevFit(F64 low, F64 high) noexcept {
+		constexpr std::size_t n = Degree + 1u;
+		constexpr F64 pi = std::numbers::pi_v< F64 >;
+
+		// x = mid + half u, u in [-1, 1]
+		const F64 mid  = 0.5 * (low + high);
+		const F64 half = 0.5 * (high - low);
+
+		// Chebyshev coefficients:
+		// a[j] = 2/n sum_k f(x_k) T_j(u_k), u_k = cos(pi (k + 1/2) / n)
+		std::array< F64, n > a = {};
+		for (std::size_t k = 0u; k < n; ++k) {
+			const F64 theta = pi * (static_cast< F64 >(k) + 0.5) / static_cast< F64 >(n);
+			const F64 f = FunctionT{}(mid + half * Cos(theta));
+			for (std::size_t j = 0u; j < n; ++j) {
+				// T_j(cos(theta)) = cos(j theta)
+				a[j] += 2.0 / static_cast< F64 >(n) * f * Cos(static_cast< F64 >(j) * theta);
+			}
+		}
+		a[0] *= 0.5;
+
+		// Monomial coefficients in u: T_0 = 1, T_1 = u, T_j+1 = 2 u T_j - T_j-1
+		std::array< F64, n > cu = {};
+		std::array< F64, n > t_prev = {};
+		std::array< F64, n > t = {};
+		t[0] = 1.0;
+		for (std::size_t j = 0u; j < n; ++j) {
+			for (std::size_t i = 0u; i < n; ++i) {
+				cu[i] += a[j] * t[i];
+			}
+
+			// T_1 = u is the exception to the recurrence (u T_0 instead of
+			// 2 u T_0).
+			const F64 scale = (0u == j) ? 1.0 : 2.0;
+			std::array< F64, n > t_next = {};
+			for (std::size_t i = 0u; i < n; ++i) {
+				t_next[i] = ((0u < i) ? scale * t[i - 1u] : 0.0) - t_prev[i];
+			}
+			t_prev = t;
+			t = t_next;
+		}
+
+		// Monomial coefficients in x: substitute u = (x - mid) / half with
+		// Horner's scheme, p(u) = cu[0] + u (cu[1] + u (...)).
+		const F64 alpha =  1.0 / half;
+		const F64 beta  = -mid / half;
+		std::array< F64, n > c = {};
+		for (std::size_t j = n; 0u < j--; ) {
+			// c <- c (alpha x + beta) + cu[j]
+			for (std::size_t i = n - 1u; 0u < i; --i) {
+				c[i] = c[i] * beta + c[i - 1u] * alpha;
+			}
+			c[0] = c[0] * beta + cu[j];
+		}
+
+		return c;
+	}
+
+	/**
+	 Estimates the maximum absolute error of the given polynomial with
+	 respect to the given function over [@a low, @a high] by sampling the
+	 midpoints of the given number of uniform subintervals (which exclude
+	 the interval bounds).
+	 */
+	template< typename FunctionT, std::size_t N >
+	[[nodiscard]]
+	constexpr F64 EstimateError(const std::array< F64, N >& coefficients,
+								F64 low, F64 high, std::size_t nb_samples = 1024u) noexcept {
+		F64 error = 0.0;
+		for (std::size_t k = 0u; k < nb_samples; ++k) {
+			const F64 x = low + (high - low) * (static_cast< F64 >(k) + 0.5)
+				                             / static_cast< F64 >(nb_samples);
+			F64 p = 0.0;
+			for (std::size_t i = N; 0u < i--; ) {
+				p = p * x + coefficients[i];
+			}
+			error = Max(error, Abs(p - FunctionT{}(x)));
+		}
+		return error;
+	}
+}
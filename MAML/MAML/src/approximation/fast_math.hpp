@@ -0,0 +1,340 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "approximation\chebyshev.hpp"
+#include "approximation\polynomial.hpp"
+#include "simd\math.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <bit>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	//-------------------------------------------------------------------------
+	// Precision
+	//-------------------------------------------------------------------------
+
+	/**
+	 The precision tiers of the approximations below (maximum relative
+	 errors for the ranges documented per function):
+	 - Fast:   about 1e-3;
+	 - Medium: about 1e-5;
+	 - Full:   a few ulp (F32).
+	 */
+	enum class Precision : U8 {
+		Fast = 0u,
+		Medium,
+		Full
+	};
+
+	namespace details {
+
+		//---------------------------------------------------------------------
+		// Scalar Counterparts of the Packet Helpers (see simd\math.hpp)
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		inline F32 FMA(F32 a, F32 b, F32 c) noexcept {
+			return a * b + c;
+		}
+
+		[[nodiscard]]
+		inline F32 Floor(F32 v) noexcept {
+			return std::floor(v);
+		}
+
+		[[nodiscard]]
+		inline F32 Round(F32 v) noexcept {
+			return std::nearbyint(v);
+		}
+
+		[[nodiscard]]
+		inline F32 Select(bool mask, F32 a, F32 b) noexcept {
+			return mask ? a : b;
+		}
+
+		[[nodiscard]]
+		inline F32 SignBit(F32 v) noexcept {
+			return std::bit_cast< F32 >(std::bit_cast< U32 >(v) & 0x80000000u);
+		}
+
+		[[nodiscard]]
+		inline F32 XorSign(F32 v, F32 sign) noexcept {
+			return std::bit_cast< F32 >(std::bit_cast< U32 >(v) ^ std::bit_cast< U32 >(sign));
+		}
+
+		[[nodiscard]]
+		inline F32 Pow2(F32 n) noexcept {
+			return std::bit_cast< F32 >(static_cast< U32 >(static_cast< S32 >(n) + 127) << 23u);
+		}
+
+		[[nodiscard]]
+		inline const std::pair< F32, F32 > Frexp(F32 v) noexcept {
+			const U32 bits = std::bit_cast< U32 >(v);
+			const U32 e    = (bits & 0x7F800000u) >> 23u;
+			const U32 m    = (bits & 0x807FFFFFu) | 0x3F000000u;
+			return { std::bit_cast< F32 >(m), static_cast< F32 >(static_cast< S32 >(e) - 126) };
+		}
+
+		//---------------------------------------------------------------------
+		// Fitted Functions
+		//---------------------------------------------------------------------
+
+		template< std::size_t N >
+		[[nodiscard]]
+		constexpr const std::array< F32, N > ToF32(const std::array< F64, N >& c) noexcept {
+			std::array< F32, N > result = {};
+			for (std::size_t i = 0u; i < N; ++i) {
+				result[i] = static_cast< F32 >(c[i]);
+			}
+			return result;
+		}
+
+		template< Precision P >
+		[[nodiscard]]
+		constexpr std::size_t SelectDegree(std::size_t fast,
+										   std::size_t medium,
+										   std::size_t full) noexcept {
+			switch (P) {
+			case Precision::Fast:
+				return fast;
+			case Precision::Medium:
+				return medium;
+			default:
+				return full;
+			}
+		}
+
+		// sin(r) = r SinKernel(r^2) and cos(r) = CosKernel(r^2) for
+		// r in [-pi/4, pi/4].
+
+		struct SinKernel {
+
+		public:
+
+			[[nodiscard]]
+			constexpr F64 operator()(F64 z) const noexcept {
+				const F64 r = maml::Sqrt(z);
+				return maml::Sin(r) / r;
+			}
+		};
+
+		struct CosKernel {
+
+		public:
+
+			[[nodiscard]]
+			constexpr F64 operator()(F64 z) const noexcept {
+				return maml::Cos(maml::Sqrt(z));
+			}
+		};
+
+		// exp(r) = ExpKernel(r) for r in [-ln(2)/2, ln(2)/2].
+
+		struct ExpKernel {
+
+		public:
+
+			[[nodiscard]]
+			constexpr F64 operator()(F64 r) const noexcept {
+				return maml::Exp(r);
+			}
+		};
+
+		// ln(1 + f) = f LogKernel(f) for f in [sqrt(2)/2 - 1, sqrt(2) - 1].
+
+		struct LogKernel {
+
+		public:
+
+			[[nodiscard]]
+			constexpr F64 operator()(F64 f) const noexcept {
+				return maml::Ln(1.0 + f) / f;
+			}
+		};
+
+		constexpr F64 g_pi_4_sqr = 0.25 * 0.25 * std::numbers::pi_v< F64 > * std::numbers::pi_v< F64 >;
+
+		template< Precision P >
+		inline constexpr auto g_sin_coefficients = ToF32(
+			ChebyshevFit< SinKernel, SelectDegree< P >(1u, 2u, 3u) >(0.0, g_pi_4_sqr));
+
+		template< Precision P >
+		inline constexpr auto g_cos_coefficients = ToF32(
+			ChebyshevFit< CosKernel, SelectDegree< P >(2u, 3u, 4u) >(0.0, g_pi_4_sqr));
+
+		template< Precision P >
+		inline constexpr auto g_exp_coefficients = ToF32(
+			ChebyshevFit< ExpKernel, SelectDegree< P >(3u, 4u, 6u) >(
+				-0.5 * std::numbers::ln2_v< F64 >, 0.5 * std::numbers::ln2_v< F64 >));
+
+		template< Precision P >
+		inline constexpr auto g_log_coefficients = ToF32(
+			ChebyshevFit< LogKernel, SelectDegree< P >(3u, 5u, 8u) >(
+				0.5 * std::numbers::sqrt2_v< F64 > - 1.0, std::numbers::sqrt2_v< F64 > - 1.0));
+
+		//---------------------------------------------------------------------
+		// Kernels
+		//---------------------------------------------------------------------
+
+		template< Precision P, bool CosV, typename VectorT >
+		[[nodiscard]]
+		inline const VectorT __vectorcall FastSinOrCos(const VectorT& x) noexcept {
+			const VectorT ax = Abs(x);
+
+			// |x| = q * pi/2 + r, |r| <= pi/4 (Cody-Waite with pi/2 in 3 parts).
+			const VectorT q = Round(ax * 0.636619772367581343f);
+			VectorT r = FMA(q, VectorT(-1.5703125f), ax);
+			r = FMA(q, VectorT(-4.837512969970703125e-4f), r);
+			r = FMA(q, VectorT(-7.54978995489188216e-8f), r);
+
+			const VectorT z = r * r;
+			const VectorT s = r * maml::EvalPoly(z, g_sin_coefficients< P >);
+			const VectorT c = maml::EvalPoly(z, g_cos_coefficients< P >);
+
+			// Quadrant k = q mod 4:
+			// sin(|x|) = ( sin r,  cos r, -sin r, -cos r)[k]
+			// cos(|x|) = ( cos r, -sin r, -cos r,  sin r)[k]
+			const VectorT k = q - 4.0f * Floor(q * 0.25f);
+			const auto odd  = (k == VectorT(1.0f)) | (k == VectorT(3.0f));
+			if constexpr (CosV) {
+				const VectorT cos_sign = SignBit(Abs(k - 1.5f) - 1.0f);
+				return XorSign(Select(odd, s, c), cos_sign);
+			}
+			else {
+				const VectorT sin_sign = XorSign(SignBit(VectorT(1.0f) - k), SignBit(x));
+				return XorSign(Select(odd, c, s), sin_sign);
+			}
+		}
+
+		template< Precision P, typename VectorT >
+		[[nodiscard]]
+		inline const VectorT __vectorcall FastExp(const VectorT& x) noexcept {
+			constexpr F32 lo = -103.972084f; // ln(2^-150)
+			constexpr F32 hi =   88.7228394f; // ln(FLT_MAX)
+
+			const VectorT xc = Min(Max(x, VectorT(lo)), VectorT(hi));
+
+			// x = n * ln(2) + r, |r| <= ln(2) / 2 (Cody-Waite).
+			const VectorT n = Round(xc * 1.44269504088896341f);
+			VectorT r = FMA(n, VectorT(-0.693359375f), xc);
+			r = FMA(n, VectorT(2.12194440e-4f), r);
+
+			const VectorT p = maml::EvalPoly(r, g_exp_coefficients< P >);
+
+			// 2^n is applied in two steps to reach the subnormal and the
+			// largest normal results.
+			const VectorT n1 = Floor(n * 0.5f);
+			const VectorT n2 = n - n1;
+			VectorT result = p * Pow2(n1) * Pow2(n2);
+
+			constexpr F32 inf = std::numeric_limits< F32 >::infinity();
+			result = Select(x > VectorT(hi), VectorT(inf), result);
+			result = Select(x < VectorT(lo), VectorT(0.0f), result);
+			return Select(x != x, x, result);
+		}
+
+		template< Precision P, typename VectorT >
+		[[nodiscard]]
+		inline const VectorT __vectorcall FastLog(const VectorT& x) noexcept {
+			// Scale subnormals into the normal range.
+			const auto subnormal = x < VectorT(std::numeric_limits< F32 >::min());
+			const VectorT xs = Select(subnormal, x * 8388608.0f, x);
+
+			auto [m, e] = Frexp(xs);
+			e -= Select(subnormal, VectorT(23.0f), VectorT(0.0f));
+
+			// m in [sqrt(2)/2, sqrt(2)) - 1
+			const auto small = m < VectorT(0.707106781186547524f);
+			e -= Select(small, VectorT(1.0f), VectorT(0.0f));
+			const VectorT f = m + Select(small, m, VectorT(0.0f)) - 1.0f;
+
+			// ln(x) = e ln(2) + f P(f)
+			const VectorT p = f * maml::EvalPoly(f, g_log_coefficients< P >);
+			VectorT result = FMA(e, VectorT(0.693359375f), FMA(e, VectorT(-2.12194440e-4f), p));
+
+			constexpr F32 inf = std::numeric_limits< F32 >::infinity();
+			constexpr F32 nan = std::numeric_limits< F32 >::quiet_NaN();
+			result = Select(x == VectorT(inf), x, result);
+			result = Select(x == VectorT(0.0f), VectorT(-inf), result);
+			return Select((x < VectorT(0.0f)) | (x != x), VectorT(nan), result);
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// Sin and Cos
+	//-------------------------------------------------------------------------
+
+	/**
+	 Computes the sine with the given precision (F32, F32x4S or F32x8S).
+
+	 The polynomial coefficients are fitted at compile time (see
+	 ChebyshevFit). The errors are absolute for |x| <= 8192 (and degrade
+	 gradually beyond).
+	 */
+	template< Precision P, typename T >
+	[[nodiscard]]
+	inline const T __vectorcall Sin(const T& x) noexcept {
+		return details::FastSinOrCos< P, false >(x);
+	}
+
+	/**
+	 Computes the cosine with the given precision (F32, F32x4S or F32x8S).
+
+	 The polynomial coefficients are fitted at compile time (see
+	 ChebyshevFit). The errors are absolute for |x| <= 8192 (and degrade
+	 gradually beyond).
+	 */
+	template< Precision P, typename T >
+	[[nodiscard]]
+	inline const T __vectorcall Cos(const T& x) noexcept {
+		return details::FastSinOrCos< P, true >(x);
+	}
+
+	//-------------------------------------------------------------------------
+	// Exp and Log
+	//-------------------------------------------------------------------------
+
+	/**
+	 Computes e^x with the given precision (F32, F32x4S or F32x8S).
+
+	 The polynomial coefficients are fitted at compile time (see
+	 ChebyshevFit). Results below 2^-126 are subnormal (flushed to zero
+	 below 2^-150), results above FLT_MAX are +inf.
+	 */
+	template< Precision P, typename T >
+	[[nodiscard]]
+	inline const T __vectorcall Exp(const T& x) noexcept {
+		return details::FastExp< P >(x);
+	}
+
+	/**
+	 Computes the natural logarithm with the given precision (F32, F32x4S or
+	 F32x8S).
+
+	 The polynomial coefficients are fitted at compile time (see
+	 ChebyshevFit). The errors are absolute. Log(0) = -inf, Log(+inf) = +inf,
+	 and Log(x) = NaN for negative and NaN x.
+	 */
+	template< Precision P, typename T >
+	[[nodiscard]]
+	inline const T __vectorcall Log(const T& x) noexcept {
+		return details::FastLog< P >(x);
+	}
+}
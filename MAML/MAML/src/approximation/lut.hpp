@@ -0,0 +1,272 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "constexpr\math.hpp"
+#include "simd\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+#include <immintrin.h>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	namespace details {
+
+		template< typename FunctionT, typename T, std::size_t N >
+		[[nodiscard]]
+		constexpr const std::array< T, N > GenerateLUT(F64 x0, F64 step) noexcept {
+			std::array< T, N > table = {};
+			for (std::size_t i = 0u; i < N; ++i) {
+				table[i] = static_cast< T >(FunctionT{}(x0 + static_cast< F64 >(i) * step));
+			}
+			return table;
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// LUT
+	//-------------------------------------------------------------------------
+
+	/**
+	 A lookup table of N uniformly spaced samples of a function over
+	 [Low, High], generated at compile time.
+
+	 The function is a stateless function object type invoked with F64
+	 arguments, e.g. decltype([](F64 x) { return Sin(x); }) for the constexpr
+	 functions of constexpr\math.hpp. The table is a constexpr static member
+	 (stored in read-only memory without any initialization at runtime), and
+	 contains one additional sample on each side of the interval for the
+	 cubic interpolation. Lookups clamp their argument to [Low, High].
+
+	 The F32x4S lookups gather the samples with AVX2 (and load them
+	 individually otherwise).
+	 */
+	template< typename FunctionT, std::size_t N, F64 Low, F64 High, typename T = F32 >
+	class LUT {
+
+	public:
+
+		static_assert(1u < N);
+		static_assert(Low < High);
+		static_assert(std::is_floating_point_v< T >);
+
+		using value_type = T;
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		static constexpr std::size_t s_size = N;
+		static constexpr F64 s_low  = Low;
+		static constexpr F64 s_high = High;
+		static constexpr F64 s_step = (High - Low) / static_cast< F64 >(N - 1u);
+
+		/**
+		 The samples f(Low + (i - 1) * s_step) for i in [0, N + 2).
+		 */
+		static constexpr std::array< T, N + 2u > s_table
+			= details::GenerateLUT< FunctionT, T, N + 2u >(Low - s_step, s_step);
+
+		//---------------------------------------------------------------------
+		// Class Member Methods: Scalar Lookup
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the sample nearest to the given value.
+		 */
+		[[nodiscard]]
+		static T Nearest(T x) noexcept {
+			const T t = ToIndexSpace(x);
+			return s_table[static_cast< std::size_t >(t + T(0.5)) + 1u];
+		}
+
+		/**
+		 Returns the linear interpolation of the samples surrounding the given
+		 value (see EstimateLinearError).
+		 */
+		[[nodiscard]]
+		static T Linear(T x) noexcept {
+			const T t = ToIndexSpace(x);
+			const std::size_t i = Segment(t);
+			const T f = t - static_cast< T >(i);
+			const T* const p = s_table.data() + i + 1u;
+			// p0 + f (p1 - p0)
+			return p[0] + f * (p[1] - p[0]);
+		}
+
+		/**
+		 Returns the cubic (Catmull-Rom) interpolation of the four samples
+		 surrounding the given value (see EstimateCubicError).
+		 */
+		[[nodiscard]]
+		static T Cubic(T x) noexcept {
+			const T t = ToIndexSpace(x);
+			const std::size_t i = Segment(t);
+			const T f = t - static_cast< T >(i);
+			const T* const p = s_table.data() + i;
+			return CatmullRom(p[0], p[1], p[2], p[3], f);
+		}
+
+		//---------------------------------------------------------------------
+		// Class Member Methods: Packet Lookup
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		static const F32x4S __vectorcall Nearest(const F32x4S& x) noexcept {
+			static_assert(std::is_same_v< F32, T >);
+
+			const F32x4S t = ToIndexSpace(x);
+			const __m128i i = _mm_cvttps_epi32((t + 0.5f).m_v);
+			return Gather(i, 1);
+		}
+
+		[[nodiscard]]
+		static const F32x4S __vectorcall Linear(const F32x4S& x) noexcept {
+			static_assert(std::is_same_v< F32, T >);
+
+			const F32x4S t = ToIndexSpace(x);
+			const __m128i i = Segment(t);
+			const F32x4S f = t - F32x4S(_mm_cvtepi32_ps(i));
+			const F32x4S p0 = Gather(i, 1);
+			const F32x4S p1 = Gather(i, 2);
+			return FMA(f, p1 - p0, p0);
+		}
+
+		[[nodiscard]]
+		static const F32x4S __vectorcall Cubic(const F32x4S& x) noexcept {
+			static_assert(std::is_same_v< F32, T >);
+
+			const F32x4S t = ToIndexSpace(x);
+			const __m128i i = Segment(t);
+			const F32x4S f = t - F32x4S(_mm_cvtepi32_ps(i));
+			return CatmullRom(Gather(i, 0), Gather(i, 1), Gather(i, 2), Gather(i, 3), f);
+		}
+
+		//---------------------------------------------------------------------
+		// Class Member Methods: Error Estimation
+		//---------------------------------------------------------------------
+
+		/**
+		 Estimates the maximum absolute error of Linear by comparing against
+		 the function at the midpoints of all segments, excluding the
+		 rounding errors of the evaluation in T (evaluate in a constant
+		 expression to avoid the runtime cost).
+		 */
+		[[nodiscard]]
+		static constexpr F64 EstimateLinearError() noexcept {
+			F64 error = 0.0;
+			for (std::size_t i = 0u; i + 1u < N; ++i) {
+				const F64 p = 0.5 * (static_cast< F64 >(s_table[i + 1u])
+								   + static_cast< F64 >(s_table[i + 2u]));
+				error = Max(error, Abs(p - Midpoint(i)));
+			}
+			return error;
+		}
+
+		/**
+		 Estimates the maximum absolute error of Cubic by comparing against
+		 the function at the midpoints of all segments, excluding the
+		 rounding errors of the evaluation in T (evaluate in a constant
+		 expression to avoid the runtime cost).
+		 */
+		[[nodiscard]]
+		static constexpr F64 EstimateCubicError() noexcept {
+			F64 error = 0.0;
+			for (std::size_t i = 0u; i + 1u < N; ++i) {
+				const F64 p = CatmullRom(static_cast< F64 >(s_table[i]),
+										 static_cast< F64 >(s_table[i + 1u]),
+										 static_cast< F64 >(s_table[i + 2u]),
+										 static_cast< F64 >(s_table[i + 3u]),
+										 0.5);
+				error = Max(error, Abs(p - Midpoint(i)));
+			}
+			return error;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		static constexpr F64 Midpoint(std::size_t i) noexcept {
+			return FunctionT{}(Low + (static_cast< F64 >(i) + 0.5) * s_step);
+		}
+
+		template< typename U >
+		[[nodiscard]]
+		static constexpr const U CatmullRom(const U& p0, const U& p1,
+											const U& p2, const U& p3,
+											const U& f) noexcept {
+			// p1 + f/2 (p2 - p0 + f (2 p0 - 5 p1 + 4 p2 - p3
+			//                        + f (3 (p1 - p2) + p3 - p0)))
+			const U c1 = p2 - p0;
+			const U c2 = (p0 + p0) - U(5.0f) * p1 + U(4.0f) * p2 - p3;
+			const U c3 = U(3.0f) * (p1 - p2) + p3 - p0;
+			return p1 + U(0.5f) * f * (c1 + f * (c2 + f * c3));
+		}
+
+		// Maps [Low, High] to [0, N - 1].
+
+		[[nodiscard]]
+		static T ToIndexSpace(T x) noexcept {
+			constexpr T max_t = static_cast< T >(N - 1u);
+			const T t = (x - static_cast< T >(Low)) * static_cast< T >(1.0 / s_step);
+			return (t > T(0)) ? ((t < max_t) ? t : max_t) : T(0);
+		}
+
+		[[nodiscard]]
+		static const F32x4S __vectorcall ToIndexSpace(const F32x4S& x) noexcept {
+			constexpr F32 max_t = static_cast< F32 >(N - 1u);
+			const F32x4S t = (x - static_cast< F32 >(Low)) * static_cast< F32 >(1.0 / s_step);
+			return Min(Max(t, F32x4S(0.0f)), F32x4S(max_t));
+		}
+
+		// Returns the index of the segment [i, i + 1] containing t (the last
+		// segment for t = N - 1).
+
+		[[nodiscard]]
+		static std::size_t Segment(T t) noexcept {
+			const std::size_t i = static_cast< std::size_t >(t);
+			return (i < N - 1u) ? i : N - 2u;
+		}
+
+		[[nodiscard]]
+		static __m128i __vectorcall Segment(const F32x4S& t) noexcept {
+			// Clamp in float space: _mm_min_epi32 requires SSE4.1.
+			const F32x4S c = Min(t, F32x4S(static_cast< F32 >(N - 2u)));
+			return _mm_cvttps_epi32(c.m_v);
+		}
+
+		// Loads s_table[i + offset] for each lane.
+
+		[[nodiscard]]
+		static const F32x4S __vectorcall Gather(__m128i i, int offset) noexcept {
+			#ifdef __AVX2__
+			return _mm_i32gather_ps(s_table.data() + offset, i, 4);
+			#else
+			alignas(16) S32 indices[4];
+			_mm_store_si128(reinterpret_cast< __m128i* >(indices), i);
+			const F32* const table = s_table.data() + offset;
+			return _mm_setr_ps(table[indices[0]], table[indices[1]],
+							   table[indices[2]], table[indices[3]]);
+			#endif
+		}
+	};
+}
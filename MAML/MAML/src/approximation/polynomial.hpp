@@ -0,0 +1,231 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "simd\cpu.hpp"
+#include "simd\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+#include <span>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	namespace details {
+
+		// a * b + c (fused for packets, see FMA; a plain multiply-add for
+		// scalars to remain usable in constant expressions).
+
+		template< typename T >
+		[[nodiscard]]
+		constexpr const T __vectorcall MulAdd(const T& a, const T& b, const T& c) noexcept {
+			if constexpr (std::is_arithmetic_v< T >) {
+				return a * b + c;
+			}
+			else {
+				return FMA(a, b, c);
+			}
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// Polynomial Evaluation
+	//-------------------------------------------------------------------------
+
+	/**
+	 Evaluates the polynomial c[0] + c[1] x + ... + c[N-1] x^(N-1) with
+	 Horner's scheme (N - 1 dependent multiply-adds).
+
+	 @param[in]		x
+					The value (a scalar or a packet).
+	 @param[in]		coefficients
+					The coefficients (broadcast to the type of @a x).
+	 */
+	template< typename T, typename U, std::size_t N >
+	[[nodiscard]]
+	constexpr const T __vectorcall EvalHorner(const T& x,
+											  const std::array< U, N >& coefficients) noexcept {
+		static_assert(0u < N);
+
+		T result(coefficients[N - 1u]);
+		for (std::size_t i = N - 1u; 0u < i--; ) {
+			result = details::MulAdd(result, x, T(coefficients[i]));
+		}
+		return result;
+	}
+
+	/**
+	 Evaluates the polynomial c[0] + c[1] x + ... + c[N-1] x^(N-1) with
+	 Estrin's scheme: (c[0] + c[1] x) + (c[2] + c[3] x) x^2 + ... is
+	 evaluated recursively in x^2, x^4, ..., which shortens the dependency
+	 chain to about 2 log2(N) multiply-adds at the cost of the extra powers.
+
+	 @param[in]		x
+					The value (a scalar or a packet).
+	 @param[in]		coefficients
+					The coefficients (broadcast to the type of @a x).
+	 */
+	template< typename T, typename U, std::size_t N >
+	[[nodiscard]]
+	constexpr const T __vectorcall EvalEstrin(const T& x,
+											  const std::array< U, N >& coefficients) noexcept {
+		static_assert(0u < N);
+
+		if constexpr (1u == N) {
+			return T(coefficients[0]);
+		}
+		else {
+			std::array< T, (N + 1u) / 2u > pairs;
+			for (std::size_t i = 0u; i < N / 2u; ++i) {
+				pairs[i] = details::MulAdd(T(coefficients[2u * i + 1u]), x,
+										   T(coefficients[2u * i]));
+			}
+			if constexpr (0u != N % 2u) {
+				pairs[N / 2u] = T(coefficients[N - 1u]);
+			}
+			return EvalEstrin(x * x, pairs);
+		}
+	}
+
+	/**
+	 Evaluates the polynomial c[0] + c[1] x + ... + c[N-1] x^(N-1) with
+	 Horner's scheme up to degree 3 and Estrin's scheme above.
+
+	 The evaluation is usable in constant expressions for scalars, and uses
+	 FMA for packets (F32x4S and F32x8S).
+
+	 @param[in]		x
+					The value (a scalar or a packet).
+	 @param[in]		coefficients
+					The coefficients (broadcast to the type of @a x).
+	 */
+	template< typename T, typename U, std::size_t N >
+	[[nodiscard]]
+	constexpr const T __vectorcall EvalPoly(const T& x,
+											const std::array< U, N >& coefficients) noexcept {
+		if constexpr (N <= 4u) {
+			return EvalHorner(x, coefficients);
+		}
+		else {
+			return EvalEstrin(x, coefficients);
+		}
+	}
+
+	namespace details {
+
+		template< typename VectorT, std::size_t N >
+		inline void EvalPoly(const F32* x, F32* output, std::size_t n,
+							 const std::array< F32, N >& coefficients) noexcept {
+			std::size_t i = 0u;
+			if constexpr (!std::is_void_v< VectorT >) {
+				constexpr std::size_t s_width = sizeof(VectorT) / sizeof(F32);
+				for (; i + s_width <= n; i += s_width) {
+					maml::EvalPoly(VectorT::LoadUnaligned(x + i), coefficients).StoreUnaligned(output + i);
+				}
+			}
+
+			for (; i < n; ++i) {
+				output[i] = maml::EvalPoly(x[i], coefficients);
+			}
+		}
+	}
+
+	/**
+	 Evaluates the given polynomial for all given values with the kernel of
+	 the active SIMD level (SSE2 or higher is vectorized).
+
+	 @pre			@a output is at least as large as @a x.
+	 @param[in]		x
+					The values.
+	 @param[out]	output
+					The polynomial evaluated at the given values (may alias
+					@a x).
+	 @param[in]		coefficients
+					The coefficients c of the polynomial
+					c[0] + c[1] x + ... + c[N-1] x^(N-1).
+	 */
+	template< std::size_t N >
+	inline void EvalPoly(std::span< const F32 > x, std::span< F32 > output,
+						 const std::array< F32, N >& coefficients) noexcept {
+
+		const SIMDLevel level = GetSIMDLevel();
+		#ifdef MAML_HAS_AVX2_VECTORS
+		if (SIMDLevel::AVX2 <= level) {
+			details::EvalPoly< F32x8S >(x.data(), output.data(), x.size(), coefficients);
+			return;
+		}
+		#endif
+		if (SIMDLevel::SSE2 <= level) {
+			details::EvalPoly< F32x4S >(x.data(), output.data(), x.size(), coefficients);
+		}
+		else {
+			details::EvalPoly< void >(x.data(), output.data(), x.size(), coefficients);
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// Polynomial
+	//-------------------------------------------------------------------------
+
+	/**
+	 A polynomial C0 + C1 x + C2 x^2 + ... with compile-time coefficients
+	 (see EvalPoly).
+	 */
+	template< typename T, T... CoefficientsV >
+	class Polynomial {
+
+	public:
+
+		static_assert(0u < sizeof...(CoefficientsV));
+		static_assert(std::is_floating_point_v< T >);
+
+		using value_type = T;
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		static constexpr std::size_t s_degree = sizeof...(CoefficientsV) - 1u;
+
+		static constexpr std::array< T, sizeof...(CoefficientsV) > s_coefficients
+			= { CoefficientsV... };
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Evaluates this polynomial at the given value (a scalar or a packet).
+		 */
+		template< typename U >
+		[[nodiscard]]
+		static constexpr const U __vectorcall Evaluate(const U& x) noexcept {
+			return EvalPoly(x, s_coefficients);
+		}
+
+		/**
+		 Evaluates this polynomial for all given values (see EvalPoly).
+
+		 @pre			@a output is at least as large as @a x.
+		 */
+		static void Evaluate(std::span< const F32 > x, std::span< F32 > output) noexcept {
+			static_assert(std::is_same_v< F32, T >);
+
+			EvalPoly(x, output, s_coefficients);
+		}
+	};
+}
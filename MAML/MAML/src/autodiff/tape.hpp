@@ -0,0 +1,578 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	template< typename T >
+	class Tape;
+
+	//-------------------------------------------------------------------------
+	// Var
+	//-------------------------------------------------------------------------
+
+	/**
+	 A variable for reverse-mode automatic differentiation. Every operation on
+	 variables is recorded as a node on the tape of its operands; a single
+	 backward sweep over the tape (see Tape::Backward) then yields the
+	 gradient of one output with respect to all variables at once.
+
+	 A Var without a tape is a constant. Operations on constants only are
+	 not recorded.
+	 */
+	template< typename T >
+	class Var {
+
+	public:
+
+		static_assert(std::is_floating_point_v< T >);
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a constant.
+		 */
+		constexpr explicit Var(T x = T(0)) noexcept
+			: m_value(x), m_tape(nullptr), m_index(s_no_index) {}
+
+		constexpr Var(const Var& v) noexcept = default;
+
+		constexpr Var(Var&& v) noexcept = default;
+
+		~Var() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		Var& operator=(const Var& v) noexcept = default;
+
+		Var& operator=(Var&& v) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		constexpr const T Re() const noexcept {
+			return m_value;
+		}
+
+		[[nodiscard]]
+		constexpr Tape< T >* GetTape() const noexcept {
+			return m_tape;
+		}
+
+		[[nodiscard]]
+		constexpr bool IsConstant() const noexcept {
+			return nullptr == m_tape;
+		}
+
+		[[nodiscard]]
+		const Var operator+() const noexcept {
+			return *this;
+		}
+
+		[[nodiscard]]
+		const Var operator-() const {
+			// d(-a) = -da
+			return Unary(*this, -Re(), T(-1));
+		}
+
+		[[nodiscard]]
+		const Var operator+(const Var& v) const {
+			// d(a + b) = da + db
+			return Binary(*this, v, Re() + v.Re(), T(1), T(1));
+		}
+
+		[[nodiscard]]
+		const Var operator-(const Var& v) const {
+			// d(a - b) = da - db
+			return Binary(*this, v, Re() - v.Re(), T(1), T(-1));
+		}
+
+		[[nodiscard]]
+		const Var operator*(const Var& v) const {
+			// d(a * b) = b da + a db
+			return Binary(*this, v, Re() * v.Re(), v.Re(), Re());
+		}
+
+		[[nodiscard]]
+		const Var operator/(const Var& v) const {
+			// d(a / b) = da / b - a / b^2 db
+			const T inv = T(1) / v.Re();
+			const T re  = Re() * inv;
+			return Binary(*this, v, re, inv, -re * inv);
+		}
+
+		[[nodiscard]]
+		const Var operator+(T a) const {
+			return Unary(*this, Re() + a, T(1));
+		}
+
+		[[nodiscard]]
+		const Var operator-(T a) const {
+			return Unary(*this, Re() - a, T(1));
+		}
+
+		[[nodiscard]]
+		const Var operator*(T a) const {
+			return Unary(*this, Re() * a, a);
+		}
+
+		[[nodiscard]]
+		const Var operator/(T a) const {
+			const T inv_a = T(1) / a;
+			return Unary(*this, Re() * inv_a, inv_a);
+		}
+
+		Var& operator+=(const Var& v) {
+			return *this = *this + v;
+		}
+
+		Var& operator-=(const Var& v) {
+			return *this = *this - v;
+		}
+
+		Var& operator*=(const Var& v) {
+			return *this = *this * v;
+		}
+
+		Var& operator/=(const Var& v) {
+			return *this = *this / v;
+		}
+
+		Var& operator+=(T a) {
+			return *this = *this + a;
+		}
+
+		Var& operator-=(T a) {
+			return *this = *this - a;
+		}
+
+		Var& operator*=(T a) {
+			return *this = *this * a;
+		}
+
+		Var& operator/=(T a) {
+			return *this = *this / a;
+		}
+
+		[[nodiscard]]
+		constexpr bool operator==(const Var& v) const {
+			return Re() == v.Re();
+		}
+
+		[[nodiscard]]
+		constexpr bool operator!=(const Var& v) const {
+			return !(*this == v);
+		}
+
+		/**
+		 Records a node with the given value and the given partial derivative
+		 with respect to the given operand.
+		 */
+		[[nodiscard]]
+		static const Var Unary(const Var& a, T value, T da);
+
+		/**
+		 Records a node with the given value and the given partial
+		 derivatives with respect to the given operands.
+
+		 @pre			@a a and @a b are constants or are recorded on the
+						same tape.
+		 */
+		[[nodiscard]]
+		static const Var Binary(const Var& a, const Var& b, T value, T da, T db);
+
+	private:
+
+		friend class Tape< T >;
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		static constexpr U32 s_no_index = std::numeric_limits< U32 >::max();
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		constexpr Var(T x, Tape< T >* tape, U32 index) noexcept
+			: m_value(x), m_tape(tape), m_index(index) {}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		T m_value;
+		Tape< T >* m_tape;
+		U32 m_index;
+	};
+
+	template< typename T >
+	[[nodiscard]]
+	inline const Var< T > operator+(T a, const Var< T >& v) {
+		return v + a;
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	inline const Var< T > operator-(T a, const Var< T >& v) {
+		// d(a - v) = -dv
+		return Var< T >::Unary(v, a - v.Re(), T(-1));
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	inline const Var< T > operator*(T a, const Var< T >& v) {
+		return v * a;
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	inline const Var< T > operator/(T a, const Var< T >& v) {
+		// d(a / v) = -a / v^2 dv
+		const T inv = T(1) / v.Re();
+		const T re  = a * inv;
+		return Var< T >::Unary(v, re, -re * inv);
+	}
+
+	//-------------------------------------------------------------------------
+	// Tape
+	//-------------------------------------------------------------------------
+
+	/**
+	 A tape recording the operations on Var< T > variables.
+
+	 Nodes are bump-allocated from fixed-size blocks that are kept until the
+	 tape is destroyed: recording never allocates per node, and rewinding to
+	 a checkpoint reuses the recorded memory across iterations. A tape must
+	 not be used by multiple threads concurrently.
+	 */
+	template< typename T >
+	class Tape {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		using Checkpoint = U32;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		Tape() = default;
+
+		/**
+		 Constructs a tape with room for at least the given number of nodes.
+		 */
+		explicit Tape(std::size_t capacity)
+			: Tape() {
+
+			Reserve(capacity);
+		}
+
+		// Variables refer to their tape.
+		Tape(const Tape& tape) = delete;
+		Tape(Tape&& tape) = delete;
+		~Tape() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		Tape& operator=(const Tape& tape) = delete;
+		Tape& operator=(Tape&& tape) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of recorded nodes.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Returns the number of nodes that can be recorded without allocating.
+		 */
+		[[nodiscard]]
+		std::size_t capacity() const noexcept {
+			return m_blocks.size() * s_block_size;
+		}
+
+		void Reserve(std::size_t capacity) {
+			while (this->capacity() < capacity) {
+				m_blocks.push_back(std::make_unique< Node[] >(s_block_size));
+			}
+		}
+
+		/**
+		 Records an independent variable with the given value.
+		 */
+		[[nodiscard]]
+		const Var< T > Variable(T x) {
+			return Push(x, Var< T >::s_no_index, T(0), Var< T >::s_no_index, T(0));
+		}
+
+		/**
+		 Returns a checkpoint of the current tape position. Variables
+		 recorded before the checkpoint stay valid after rewinding to it.
+		 */
+		[[nodiscard]]
+		Checkpoint GetCheckpoint() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Discards all nodes recorded after the given checkpoint. The memory
+		 of the discarded nodes is reused by subsequent recordings.
+		 */
+		void Rewind(Checkpoint checkpoint) noexcept {
+			m_size = checkpoint;
+			m_nb_adjoints = std::min(m_nb_adjoints, checkpoint);
+		}
+
+		void Clear() noexcept {
+			Rewind(0u);
+		}
+
+		/**
+		 Computes the adjoints (partial derivatives of the given output) of
+		 all nodes recorded up to the given output in a single backward
+		 sweep. Query them with Gradient.
+
+		 @pre			@a output is recorded on this tape and is not discarded
+						(see Rewind).
+		 */
+		void Backward(const Var< T >& output) noexcept {
+			m_nb_adjoints = 0u;
+			if (this != output.m_tape || output.m_index >= m_size) {
+				return;
+			}
+
+			const U32 last = output.m_index;
+			m_nb_adjoints = last + 1u;
+			for (U32 i = 0u; i <= last; ++i) {
+				GetNode(i).m_adjoint = T(0);
+			}
+			GetNode(last).m_adjoint = T(1);
+
+			for (U32 i = last + 1u; 0u != i--; ) {
+				const Node& node = GetNode(i);
+				const T adjoint = node.m_adjoint;
+				if (T(0) == adjoint) {
+					continue;
+				}
+
+				for (std::size_t j = 0u; j < 2u; ++j) {
+					if (Var< T >::s_no_index != node.m_parents[j]) {
+						GetNode(node.m_parents[j]).m_adjoint += node.m_weights[j] * adjoint;
+					}
+				}
+			}
+		}
+
+		/**
+		 Returns the partial derivative of the output of the last Backward
+		 sweep with respect to the given variable (zero for constants and
+		 for variables recorded after the output).
+		 */
+		[[nodiscard]]
+		const T Gradient(const Var< T >& v) const noexcept {
+			return (this != v.m_tape || v.m_index >= m_nb_adjoints)
+				? T(0) : GetNode(v.m_index).m_adjoint;
+		}
+
+	private:
+
+		friend class Var< T >;
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		struct Node {
+
+		public:
+
+			T m_weights[2u];
+			U32 m_parents[2u];
+			T m_adjoint;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		static constexpr std::size_t s_block_shift = 12u;
+		static constexpr std::size_t s_block_size  = std::size_t(1u) << s_block_shift;
+		static constexpr std::size_t s_block_mask  = s_block_size - 1u;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		Node& GetNode(std::size_t index) noexcept {
+			return m_blocks[index >> s_block_shift][index & s_block_mask];
+		}
+
+		[[nodiscard]]
+		const Node& GetNode(std::size_t index) const noexcept {
+			return m_blocks[index >> s_block_shift][index & s_block_mask];
+		}
+
+		[[nodiscard]]
+		const Var< T > Push(T x, U32 a, T da, U32 b, T db) {
+			if (m_size == capacity()) {
+				m_blocks.push_back(std::make_unique< Node[] >(s_block_size));
+			}
+
+			const U32 index = m_size++;
+			Node& node = GetNode(index);
+			node.m_weights[0u] = da;
+			node.m_weights[1u] = db;
+			node.m_parents[0u] = a;
+			node.m_parents[1u] = b;
+			return { x, this, index };
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		std::vector< std::unique_ptr< Node[] > > m_blocks;
+		U32 m_size = 0u;
+
+		/**
+		 The number of nodes swept by the last Backward call (i.e. up to and
+		 including its output), whose adjoints are valid.
+		 */
+		U32 m_nb_adjoints = 0u;
+	};
+
+	template< typename T >
+	inline const Var< T > Var< T >::Unary(const Var& a, T value, T da) {
+		if (a.IsConstant()) {
+			return Var(value);
+		}
+
+		return a.m_tape->Push(value, a.m_index, da, s_no_index, T(0));
+	}
+
+	template< typename T >
+	inline const Var< T > Var< T >::Binary(const Var& a, const Var& b,
+										   T value, T da, T db) {
+		if (a.IsConstant()) {
+			return Unary(b, value, db);
+		}
+		if (b.IsConstant()) {
+			return Unary(a, value, da);
+		}
+
+		return a.m_tape->Push(value, a.m_index, da, b.m_index, db);
+	}
+
+	//-------------------------------------------------------------------------
+	// Elementary Functions
+	//-------------------------------------------------------------------------
+
+	template< typename T >
+	[[nodiscard]]
+	inline const Var< T > Exp(const Var< T >& v) {
+		const T exp = std::exp(v.Re());
+		return Var< T >::Unary(v, exp, exp);
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	inline const Var< T > Ln(const Var< T >& v) {
+		return Var< T >::Unary(v, std::log(v.Re()), T(1) / v.Re());
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	inline const Var< T > Sqrt(const Var< T >& v) {
+		const T sqrt = std::sqrt(v.Re());
+		return Var< T >::Unary(v, sqrt, T(0.5) / sqrt);
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	inline const Var< T > Pow(const Var< T >& v, T exponent) {
+		// d(x^a) = a x^(a-1) dx
+		return Var< T >::Unary(v, std::pow(v.Re(), exponent),
+							   exponent * std::pow(v.Re(), exponent - T(1)));
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	inline const Var< T > Pow(const Var< T >& v, const Var< T >& exponent) {
+		// d(x^y) = x^y (y / x dx + ln(x) dy)
+		const T pow = std::pow(v.Re(), exponent.Re());
+		return Var< T >::Binary(v, exponent, pow,
+								pow * exponent.Re() / v.Re(), pow * std::log(v.Re()));
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	inline const Var< T > Sin(const Var< T >& v) {
+		return Var< T >::Unary(v, std::sin(v.Re()), std::cos(v.Re()));
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	inline const Var< T > Cos(const Var< T >& v) {
+		return Var< T >::Unary(v, std::cos(v.Re()), -std::sin(v.Re()));
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	inline const Var< T > Atan2(const Var< T >& y, const Var< T >& x) {
+		// d(atan2(y, x)) = (x dy - y dx) / (x^2 + y^2)
+		const T inv = T(1) / (x.Re() * x.Re() + y.Re() * y.Re());
+		return Var< T >::Binary(y, x, std::atan2(y.Re(), x.Re()),
+								x.Re() * inv, -y.Re() * inv);
+	}
+
+	//-------------------------------------------------------------------------
+	// Type Declarations and Definitions
+	//-------------------------------------------------------------------------
+
+	using V32 = Var< F32 >;
+	using V64 = Var< F64 >;
+}
@@ -0,0 +1,385 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "simd\swizzle.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <span>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	//-------------------------------------------------------------------------
+	// SoA
+	//-------------------------------------------------------------------------
+
+	template< typename ElementT >
+	class SoA;
+
+	/**
+	 A structure-of-arrays container for Array< T, N, A > elements: the
+	 elements are stored as N separate component arrays (e.g. x[], y[], z[]).
+
+	 Each component array is 64-byte aligned and padded to a multiple of 64
+	 bytes, so the components can be processed with aligned F32x4S/F32x8S
+	 loads and stores without a scalar remainder loop. The padding components
+	 carry no meaning (ForEachChunk may write them); resize zero-initializes
+	 new elements regardless.
+	 */
+	template< typename T, std::size_t N, std::size_t A >
+	class SoA< Array< T, N, A > > {
+
+	public:
+
+		using value_type = Array< T, N, A >;
+
+		static constexpr std::size_t s_alignment = 64u;
+		static constexpr std::size_t s_nb_components = N;
+		static constexpr std::size_t s_padding = s_alignment / sizeof(T);
+
+		static_assert(std::is_trivially_copyable_v< T >);
+		static_assert(0u == s_alignment % sizeof(T));
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		SoA() noexcept = default;
+
+		explicit SoA(std::size_t size)
+			: SoA() {
+
+			resize(size);
+		}
+
+		explicit SoA(std::span< const value_type > elements)
+			: SoA(elements.size()) {
+
+			Load(elements);
+		}
+
+		SoA(const SoA& soa)
+			: SoA() {
+
+			Allocate(soa.m_capacity);
+			m_size = soa.m_size;
+			if (nullptr != m_data) {
+				std::memcpy(m_data, soa.m_data, N * m_capacity * sizeof(T));
+			}
+		}
+
+		SoA(SoA&& soa) noexcept
+			: m_data(std::exchange(soa.m_data, nullptr)),
+			m_size(std::exchange(soa.m_size, 0u)),
+			m_capacity(std::exchange(soa.m_capacity, 0u)) {}
+
+		~SoA() {
+			Deallocate();
+		}
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		SoA& operator=(const SoA& soa) {
+			if (this != &soa) {
+				SoA copy(soa);
+				*this = std::move(copy);
+			}
+			return *this;
+		}
+
+		SoA& operator=(SoA&& soa) noexcept {
+			if (this != &soa) {
+				Deallocate();
+				m_data     = std::exchange(soa.m_data, nullptr);
+				m_size     = std::exchange(soa.m_size, 0u);
+				m_capacity = std::exchange(soa.m_capacity, 0u);
+			}
+			return *this;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Size
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Returns the padded number of elements per component array: a
+		 multiple of s_padding that is greater than or equal to size().
+		 */
+		[[nodiscard]]
+		std::size_t capacity() const noexcept {
+			return m_capacity;
+		}
+
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return 0u == m_size;
+		}
+
+		void clear() noexcept {
+			resize(0u);
+		}
+
+		/**
+		 Resizes this container. New elements are zero-initialized.
+		 */
+		void resize(std::size_t size) {
+			const std::size_t capacity = PaddedSize(size);
+			if (capacity != m_capacity) {
+				SoA soa;
+				soa.Allocate(capacity);
+				const std::size_t count = std::min(m_size, size);
+				for (std::size_t c = 0u; c < N && 0u != count; ++c) {
+					std::memcpy(soa.data(c), data(c), count * sizeof(T));
+				}
+				*this = std::move(soa);
+			}
+			else if (size != m_size) {
+				// The padding components may have been written (see
+				// ForEachChunk): zero the new elements when growing, and the
+				// removed elements when shrinking.
+				const std::size_t first = std::min(m_size, size);
+				const std::size_t last  = std::max(m_size, size);
+				for (std::size_t c = 0u; c < N; ++c) {
+					std::memset(data(c) + first, 0, (last - first) * sizeof(T));
+				}
+			}
+
+			m_size = size;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Element Access
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the 64-byte aligned component array with the given index.
+		 */
+		[[nodiscard]]
+		T* data(std::size_t component) noexcept {
+			return m_data + component * m_capacity;
+		}
+		[[nodiscard]]
+		const T* data(std::size_t component) const noexcept {
+			return m_data + component * m_capacity;
+		}
+
+		[[nodiscard]]
+		const value_type Get(std::size_t index) const noexcept {
+			value_type element;
+			for (std::size_t c = 0u; c < N; ++c) {
+				element[c] = data(c)[index];
+			}
+			return element;
+		}
+
+		void Set(std::size_t index, const value_type& element) noexcept {
+			for (std::size_t c = 0u; c < N; ++c) {
+				data(c)[index] = element[c];
+			}
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Conversion
+		//---------------------------------------------------------------------
+
+		/**
+		 Converts the given array-of-structs elements into this
+		 structure-of-arrays container.
+
+		 @pre			@a elements.size() equals size().
+		 */
+		void Load(std::span< const value_type > elements) noexcept {
+			std::size_t i = 0u;
+
+			if constexpr (IsPackedF32()) {
+				const F32* src = reinterpret_cast< const F32* >(elements.data());
+				for (; i + 4u <= m_size; i += 4u, src += 4u * N) {
+					if constexpr (3u == N) {
+						// (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3)
+						const F32x4S a = F32x4S::LoadUnaligned(src);
+						const F32x4S b = F32x4S::LoadUnaligned(src + 4u);
+						const F32x4S c = F32x4S::LoadUnaligned(src + 8u);
+						Shuffle< 0u, 1u, 2u, 5u >(Shuffle< 0u, 3u, 6u, 6u >(a, b), c).Store(data(0u) + i);
+						Shuffle< 0u, 1u, 2u, 6u >(Shuffle< 1u, 4u, 7u, 7u >(a, b), c).Store(data(1u) + i);
+						Shuffle< 0u, 1u, 4u, 7u >(Shuffle< 2u, 5u, 5u, 5u >(a, b), c).Store(data(2u) + i);
+					}
+					else {
+						F32x4S r0 = F32x4S::LoadUnaligned(src);
+						F32x4S r1 = F32x4S::LoadUnaligned(src + 4u);
+						F32x4S r2 = F32x4S::LoadUnaligned(src + 8u);
+						F32x4S r3 = F32x4S::LoadUnaligned(src + 12u);
+						Transpose(r0, r1, r2, r3);
+						r0.Store(data(0u) + i);
+						r1.Store(data(1u) + i);
+						r2.Store(data(2u) + i);
+						r3.Store(data(3u) + i);
+					}
+				}
+			}
+
+			for (; i < m_size; ++i) {
+				Set(i, elements[i]);
+			}
+		}
+
+		/**
+		 Converts this structure-of-arrays container into the given
+		 array-of-structs elements.
+
+		 @pre			@a elements.size() equals size().
+		 */
+		void Store(std::span< value_type > elements) const noexcept {
+			std::size_t i = 0u;
+
+			if constexpr (IsPackedF32()) {
+				F32* dst = reinterpret_cast< F32* >(elements.data());
+				for (; i + 4u <= m_size; i += 4u, dst += 4u * N) {
+					if constexpr (3u == N) {
+						const F32x4S x = F32x4S::Load(data(0u) + i);
+						const F32x4S y = F32x4S::Load(data(1u) + i);
+						const F32x4S z = F32x4S::Load(data(2u) + i);
+						// (x0 y0 x1 y1) and (x2 y2 x3 y3)
+						const F32x4S xy_lo = Shuffle< 0u, 4u, 1u, 5u >(x, y);
+						const F32x4S xy_hi = Shuffle< 2u, 6u, 3u, 7u >(x, y);
+						Shuffle< 0u, 1u, 4u, 2u >(xy_lo, z).StoreUnaligned(dst);
+						Shuffle< 0u, 1u, 4u, 5u >(Shuffle< 3u, 5u, 3u, 5u >(xy_lo, z), xy_hi)
+							.StoreUnaligned(dst + 4u);
+						Shuffle< 2u, 6u, 7u, 3u >(z, xy_hi).StoreUnaligned(dst + 8u);
+					}
+					else {
+						F32x4S r0 = F32x4S::Load(data(0u) + i);
+						F32x4S r1 = F32x4S::Load(data(1u) + i);
+						F32x4S r2 = F32x4S::Load(data(2u) + i);
+						F32x4S r3 = F32x4S::Load(data(3u) + i);
+						Transpose(r0, r1, r2, r3);
+						r0.StoreUnaligned(dst);
+						r1.StoreUnaligned(dst + 4u);
+						r2.StoreUnaligned(dst + 8u);
+						r3.StoreUnaligned(dst + 12u);
+					}
+				}
+			}
+
+			for (; i < m_size; ++i) {
+				elements[i] = Get(i);
+			}
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Iteration
+		//---------------------------------------------------------------------
+
+		/**
+		 Invokes the given action for each chunk of VectorT-width elements
+		 (including the padding). The action receives an
+		 Array< VectorT, N > with one packet per component, and the packets
+		 are stored back after the action returns.
+		 */
+		template< typename VectorT = F32x4S, typename ActionT >
+		void ForEachChunk(ActionT&& action) {
+			constexpr std::size_t width = sizeof(VectorT) / sizeof(T);
+			static_assert(std::is_same_v< F32, T >);
+			static_assert(0u == s_padding % width);
+
+			for (std::size_t i = 0u; i < m_size; i += width) {
+				Array< VectorT, N > chunk(VectorT(0.0f));
+				for (std::size_t c = 0u; c < N; ++c) {
+					chunk[c] = VectorT::Load(data(c) + i);
+				}
+				action(chunk);
+				for (std::size_t c = 0u; c < N; ++c) {
+					chunk[c].Store(data(c) + i);
+				}
+			}
+		}
+
+		/**
+		 Invokes the given action for each chunk of VectorT-width elements
+		 (including the padding). The action receives a const
+		 Array< VectorT, N > with one packet per component.
+		 */
+		template< typename VectorT = F32x4S, typename ActionT >
+		void ForEachChunk(ActionT&& action) const {
+			constexpr std::size_t width = sizeof(VectorT) / sizeof(T);
+			static_assert(std::is_same_v< F32, T >);
+			static_assert(0u == s_padding % width);
+
+			for (std::size_t i = 0u; i < m_size; i += width) {
+				Array< VectorT, N > chunk(VectorT(0.0f));
+				for (std::size_t c = 0u; c < N; ++c) {
+					chunk[c] = VectorT::Load(data(c) + i);
+				}
+				action(static_cast< const Array< VectorT, N >& >(chunk));
+			}
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		static constexpr bool IsPackedF32() noexcept {
+			return std::is_same_v< F32, T > && (3u == N || 4u == N)
+				&& (N * sizeof(T) == sizeof(value_type));
+		}
+
+		[[nodiscard]]
+		static constexpr std::size_t PaddedSize(std::size_t size) noexcept {
+			return (size + s_padding - 1u) / s_padding * s_padding;
+		}
+
+		void Allocate(std::size_t capacity) {
+			if (0u == capacity) {
+				return;
+			}
+
+			const std::size_t nb_bytes = N * capacity * sizeof(T);
+			m_data = static_cast< T* >(::operator new(nb_bytes, std::align_val_t(s_alignment)));
+			std::memset(m_data, 0, nb_bytes);
+			m_capacity = capacity;
+		}
+
+		void Deallocate() noexcept {
+			if (nullptr != m_data) {
+				::operator delete(m_data, std::align_val_t(s_alignment));
+			}
+			m_data     = nullptr;
+			m_size     = 0u;
+			m_capacity = 0u;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		T* m_data = nullptr;
+		std::size_t m_size = 0u;
+		std::size_t m_capacity = 0u;
+	};
+}
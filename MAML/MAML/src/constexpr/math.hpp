@@ -14,7 +14,11 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include <bit>
+#include <cmath>
 #include <limits>
+#include <numbers>
+#include <utility>
 
 #pragma endregion
 
@@ -29,6 +33,10 @@ namespace maml {
 	template< typename FromT, typename ToT = FromT >
 	using Integral = std::enable_if_t< std::is_integral_v< FromT >, ToT >;
 
+	// The transcendental functions below evaluate (range-reduced) series when
+	// constant-evaluated, using at most the given number of factors (n). At
+	// runtime, they forward to the corresponding std:: functions and ignore n.
+
 	constexpr std::size_t g_max_nb_factors = 20u;
 
 	//-------------------------------------------------------------------------
@@ -39,6 +47,10 @@ namespace maml {
 	[[nodiscard]]
 	constexpr T Abs(T x) noexcept;
 
+	template< typename T >
+	[[nodiscard]]
+	constexpr FloatingPoint< T > CopySign(T x, T sign) noexcept;
+
 	template< typename T, typename... Ts >
 	[[nodiscard]]
 	constexpr T Min(T x, T y, Ts... args) noexcept;
@@ -233,6 +245,40 @@ namespace maml {
 	constexpr Integral< T, F64 > Sin(T x,
 									 std::size_t n = g_max_nb_factors) noexcept;
 
+	//-------------------------------------------------------------------------
+	// pair< float, float >             SinCos(float x)       noexcept;
+	// pair< double, double >           SinCos(double x)      noexcept;
+	// pair< long double, long double > SinCos(long double x) noexcept;
+	// pair< double, double >           SinCos(Integral x)    noexcept;
+	//-------------------------------------------------------------------------
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr FloatingPoint< T, std::pair< T, T > > SinCos(T x,
+														   std::size_t n = g_max_nb_factors) noexcept;
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr Integral< T, std::pair< F64, F64 > > SinCos(T x,
+														  std::size_t n = g_max_nb_factors) noexcept;
+
+	//-------------------------------------------------------------------------
+	// float       Atan2(float y,       float x)       noexcept;
+	// double      Atan2(double y,      double x)      noexcept;
+	// long double Atan2(long double y, long double x) noexcept;
+	// double      Atan2(Integral y,    Integral x)    noexcept;
+	//-------------------------------------------------------------------------
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr FloatingPoint< T > Atan2(T y, T x,
+									   std::size_t n = g_max_nb_factors) noexcept;
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr Integral< T, F64 > Atan2(T y, T x,
+									   std::size_t n = g_max_nb_factors) noexcept;
+
 	//-------------------------------------------------------------------------
 	// float       Cosh(float x)       noexcept;
 	// double      Cosh(double x)      noexcept;
@@ -266,6 +312,23 @@ namespace maml {
 	[[nodiscard]]
 	constexpr Integral< T, F64 > Sinh(T x,
 									  std::size_t n = g_max_nb_factors) noexcept;
+
+	//-------------------------------------------------------------------------
+	// float       Atanh(float x)       noexcept;
+	// double      Atanh(double x)      noexcept;
+	// long double Atanh(long double x) noexcept;
+	// double      Atanh(Integral x)    noexcept;
+	//-------------------------------------------------------------------------
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr FloatingPoint< T > Atanh(T x,
+									   std::size_t n = g_max_nb_factors) noexcept;
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr Integral< T, F64 > Atanh(T x,
+									   std::size_t n = g_max_nb_factors) noexcept;
 }
 
 //-----------------------------------------------------------------------------
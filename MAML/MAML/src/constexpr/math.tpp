@@ -12,6 +12,35 @@ namespace maml {
 		return (0 <= x) ? x : -x;
 	}
 
+	namespace details {
+
+		template< typename T >
+		[[nodiscard]]
+		constexpr bool SignBit(T x) noexcept {
+			if constexpr (sizeof(T) == sizeof(U64)) {
+				return 0u != (std::bit_cast< U64 >(x) >> 63u);
+			}
+			else if constexpr (sizeof(T) == sizeof(U32)) {
+				return 0u != (std::bit_cast< U32 >(x) >> 31u);
+			}
+			else {
+				// The sign of -0 is lost for extended precision.
+				return x < T(0);
+			}
+		}
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr FloatingPoint< T > CopySign(T x, T sign) noexcept {
+		if (!std::is_constant_evaluated()) {
+			return std::copysign(x, sign);
+		}
+
+		const T abs = details::SignBit(x) ? -x : x;
+		return details::SignBit(sign) ? -abs : abs;
+	}
+
 	template< typename T >
 	[[nodiscard]]
 	constexpr T Min(T x) noexcept {
@@ -60,6 +89,82 @@ namespace maml {
 		return x * x;
 	}
 
+	namespace details {
+
+		//---------------------------------------------------------------------
+		// Argument Reduction
+		//---------------------------------------------------------------------
+
+		// ln(2) and pi/2 split into parts whose leading parts have enough
+		// trailing zero bits to be multiplied exactly by small integers.
+		constexpr F64 g_ln2_hi = 6.93147180369123816490e-01;
+		constexpr F64 g_ln2_lo = 1.90821492927058770002e-10;
+		constexpr F64 g_pi_2_1 = 1.57079632673412561417e+00;
+		constexpr F64 g_pi_2_2 = 6.07710050630396597660e-11;
+		constexpr F64 g_pi_2_3 = 2.02226624871116645580e-21;
+		constexpr F64 g_pi_2_4 = 8.47842766036889956997e-32;
+
+		template< typename T >
+		[[nodiscard]]
+		constexpr T Round(T x) noexcept {
+			// @pre |x| < 2^62
+			return static_cast< T >(static_cast< long long >(x + (T(0) <= x ? T(0.5) : T(-0.5))));
+		}
+
+		/**
+		 Returns true if x is an odd integer (values of magnitude 2^62 or
+		 larger are even).
+		 */
+		template< typename T >
+		[[nodiscard]]
+		constexpr bool IsOddInteger(T x) noexcept {
+			if (!(Abs(x) < T(1ull << 62))) {
+				return false;
+			}
+			const T half_x = x * T(0.5);
+			return Round(x) == x && Round(half_x) != half_x;
+		}
+
+		/**
+		 Computes x * 2^e exactly (unless the result is subnormal).
+		 */
+		template< typename T >
+		[[nodiscard]]
+		constexpr T LdExp(T x, int e) noexcept {
+			for (; e >= 64; e -= 64) {
+				x *= T(18446744073709551616.0);     // 2^64
+			}
+			for (; e <= -64; e += 64) {
+				x *= T(5.42101086242752217004e-20); // 2^-64
+			}
+			return x * (0 <= e ? T(1ull << e) : T(1) / T(1ull << -e));
+		}
+
+		/**
+		 Decomposes x into m * 2^e with m in [sqrt(2)/2, sqrt(2)).
+
+		 @pre			x is positive and finite.
+		 */
+		template< typename T >
+		[[nodiscard]]
+		constexpr std::pair< T, int > FrExp(T x) noexcept {
+			int e = 0;
+			for (; x >= T(18446744073709551616.0); e += 64) {
+				x *= T(5.42101086242752217004e-20);
+			}
+			for (; x < T(5.42101086242752217004e-20); e -= 64) {
+				x *= T(18446744073709551616.0);
+			}
+			for (; x >= std::numbers::sqrt2_v< T >; ++e) {
+				x *= T(0.5);
+			}
+			for (; x < T(0.5) * std::numbers::sqrt2_v< T >; --e) {
+				x *= T(2);
+			}
+			return { x, e };
+		}
+	}
+
 	//-------------------------------------------------------------------------
 	// float       Exp(float x)       noexcept;
 	// double      Exp(double x)      noexcept;
@@ -70,20 +175,48 @@ namespace maml {
 	template< typename T >
 	[[nodiscard]]
 	constexpr FloatingPoint< T > Exp(T x, std::size_t n) noexcept {
-		//          inf x^n   inf
-		// exp(x) = sum --- = sum ci
-		//          i=0  n!   i=0
-
-		T sum_old(-1);
-		T sum(0);
-		T ci(1);
-		for (std::size_t i = 0u; i < n && !Equal(sum_old, sum); ++i) {
-			sum_old = sum;
-			sum += ci;
-			ci *= x / (i + T(1));
+		if (!std::is_constant_evaluated()) {
+			return std::exp(x);
 		}
 
-		return sum;
+		if constexpr (std::is_same_v< F32, T >) {
+			return static_cast< T >(Exp(static_cast< F64 >(x), n));
+		}
+		else {
+			using limits = std::numeric_limits< T >;
+
+			if (x != x) {
+				return x;
+			}
+			// e^x overflows and underflows beyond these bounds.
+			if (x > T(limits::max_exponent) * std::numbers::ln2_v< T >) {
+				return limits::infinity();
+			}
+			if (x < T(limits::min_exponent - limits::digits) * std::numbers::ln2_v< T >) {
+				return T(0);
+			}
+
+			// x = k ln(2) + r, |r| <= ln(2)/2
+			const T k = details::Round(x * std::numbers::log2e_v< T >);
+			const T r = (x - k * T(details::g_ln2_hi)) - k * T(details::g_ln2_lo);
+
+			//              inf r^i       inf
+			// exp(r) = 1 + sum --- = 1 + sum ci
+			//              i=1  i!       i=1
+			// (adding the leading term last reduces the rounding errors)
+
+			T sum_old(-1);
+			T sum(0);
+			T ci(r);
+			for (std::size_t i = 1u; i < n && !Equal(sum_old, sum); ++i) {
+				sum_old = sum;
+				sum += ci;
+				ci *= r / (i + T(1));
+			}
+
+			// exp(x) = 2^k exp(r)
+			return details::LdExp(T(1) + sum, static_cast< int >(k));
+		}
 	}
 
 	template< typename T >
@@ -102,7 +235,50 @@ namespace maml {
 	template< typename T >
 	[[nodiscard]]
 	constexpr FloatingPoint< T > Ln(T x, std::size_t n) noexcept {
-		return 0; //TODO
+		if (!std::is_constant_evaluated()) {
+			return std::log(x);
+		}
+
+		if constexpr (std::is_same_v< F32, T >) {
+			return static_cast< T >(Ln(static_cast< F64 >(x), n));
+		}
+		else {
+			using limits = std::numeric_limits< T >;
+
+			if (x != x || x < T(0)) {
+				return limits::quiet_NaN();
+			}
+			if (T(0) == x) {
+				return -limits::infinity();
+			}
+			if (limits::infinity() == x) {
+				return x;
+			}
+
+			// x = m 2^e, m in [sqrt(2)/2, sqrt(2))
+			const auto [m, e] = details::FrExp(x);
+
+			//                                    inf s^(2*i+1)            inf
+			// ln(m) = 2 atanh(s) = 2 s + 2 sum --------- = 2 s + 2 sum ci
+			//                                    i=1  2*i+1               i=1
+			// with s = (m - 1) / (m + 1)
+
+			const T s  = (m - T(1)) / (m + T(1));
+			const T s2 = Sqr(s);
+
+			T sum_old(-1);
+			T sum(0);
+			T si(s * s2);
+			for (std::size_t i = 1u; i < n && !Equal(sum_old, sum); ++i) {
+				sum_old = sum;
+				sum += si / (T(2) * i + T(1));
+				si *= s2;
+			}
+
+			// ln(x) = e ln(2) + ln(m)
+			const T k = static_cast< T >(e);
+			return k * T(details::g_ln2_hi) + (T(2) * s + (T(2) * sum + k * T(details::g_ln2_lo)));
+		}
 	}
 
 	template< typename T >
@@ -140,6 +316,10 @@ namespace maml {
 	template< typename T >
 	[[nodiscard]]
 	constexpr FloatingPoint< T > Log(T x, T base, std::size_t n) noexcept {
+		if (!std::is_constant_evaluated()) {
+			return std::log(x) / std::log(base);
+		}
+
 		return Ln(x, n) / Ln(base, n);
 	}
 
@@ -159,8 +339,17 @@ namespace maml {
 	template< typename T >
 	[[nodiscard]]
 	constexpr FloatingPoint< T > Log2(T x, std::size_t n) noexcept {
-		constexpr T inv_ln2(1.44269504089);
-		return Ln(x, n) * inv_ln2;
+		if (!std::is_constant_evaluated()) {
+			return std::log2(x);
+		}
+
+		if (!(T(0) < x && x < std::numeric_limits< T >::infinity())) {
+			return Ln(x, n) * std::numbers::log2e_v< T >;
+		}
+
+		// log2(x) = e + ln(m) / ln(2) (exact for powers of two)
+		const auto [m, e] = details::FrExp(x);
+		return static_cast< T >(e) + Ln(m, n) * std::numbers::log2e_v< T >;
 	}
 
 	template< typename T >
@@ -179,8 +368,11 @@ namespace maml {
 	template< typename T >
 	[[nodiscard]]
 	constexpr FloatingPoint< T > Log10(T x, std::size_t n) noexcept {
-		constexpr T inv_ln10(0.4342944819);
-		return Ln(x, n) * inv_ln10;
+		if (!std::is_constant_evaluated()) {
+			return std::log10(x);
+		}
+
+		return Ln(x, n) * std::numbers::log10e_v< T >;
 	}
 
 	template< typename T >
@@ -199,7 +391,38 @@ namespace maml {
 	template< typename T >
 	[[nodiscard]]
 	constexpr FloatingPoint< T > Pow(T x, T exponent, std::size_t n) noexcept {
-		return Exp(exponent * Ln(x, n), n);
+		if (!std::is_constant_evaluated()) {
+			return std::pow(x, exponent);
+		}
+
+		if constexpr (std::is_same_v< F32, T >) {
+			return static_cast< T >(Pow(static_cast< F64 >(x), static_cast< F64 >(exponent), n));
+		}
+		else {
+			if (T(0) == exponent) {
+				return T(1);
+			}
+			if (T(0) == x) {
+				// -0 keeps its sign for odd integral exponents:
+				// Pow(-0, -1) = -inf.
+				const T result = (T(0) < exponent) ? T(0) : std::numeric_limits< T >::infinity();
+				return (details::SignBit(x) && details::IsOddInteger(exponent)) ? -result : result;
+			}
+			if (x < T(0)) {
+				// Only integral exponents have a real result.
+				if (Abs(exponent) >= T(1ull << 62)) {
+					return Pow(-x, exponent, n);
+				}
+				if (details::Round(exponent) != exponent) {
+					return std::numeric_limits< T >::quiet_NaN();
+				}
+				const T result = Pow(-x, exponent, n);
+				return details::IsOddInteger(exponent) ? -result : result;
+			}
+
+			// x^y = exp(y ln(x)): the error grows with |y ln(x)|.
+			return Exp(exponent * Ln(x, n), n);
+		}
 	}
 
 	template< typename T >
@@ -218,7 +441,42 @@ namespace maml {
 	template< typename T >
 	[[nodiscard]]
 	constexpr FloatingPoint< T > Sqrt(T x, std::size_t n) noexcept {
-		return Pow(x, T(0.5), n);
+		if (!std::is_constant_evaluated()) {
+			return std::sqrt(x);
+		}
+
+		if constexpr (std::is_same_v< F32, T >) {
+			return static_cast< T >(Sqrt(static_cast< F64 >(x), n));
+		}
+		else {
+			using limits = std::numeric_limits< T >;
+
+			if (x != x || x < T(0)) {
+				return limits::quiet_NaN();
+			}
+			if (T(0) == x || limits::infinity() == x) {
+				return x;
+			}
+
+			// x = m 2^(2*h), m in [sqrt(2)/2, 2 sqrt(2))
+			auto [m, e] = details::FrExp(x);
+			if (0 != e % 2) {
+				m *= T(2);
+				--e;
+			}
+
+			// Newton iteration y <- (y + m / y) / 2 (quadratic convergence
+			// from a relative error below 13% for the initial guess).
+			T y_old(-1);
+			T y = T(0.5) * (T(1) + m);
+			for (std::size_t i = 0u; i < n && y_old != y; ++i) {
+				y_old = y;
+				y = T(0.5) * (y + m / y);
+			}
+
+			// sqrt(x) = sqrt(m) 2^h
+			return details::LdExp(y, e / 2);
+		}
 	}
 
 	template< typename T >
@@ -227,6 +485,173 @@ namespace maml {
 		return Sqrt(static_cast< F64 >(x), n);
 	}
 
+	//-------------------------------------------------------------------------
+	// pair< float, float >             SinCos(float x)       noexcept;
+	// pair< double, double >           SinCos(double x)      noexcept;
+	// pair< long double, long double > SinCos(long double x) noexcept;
+	// pair< double, double >           SinCos(Integral x)    noexcept;
+	//-------------------------------------------------------------------------
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr FloatingPoint< T, std::pair< T, T > > SinCos(T x, std::size_t n) noexcept {
+		if (!std::is_constant_evaluated()) {
+			return { std::sin(x), std::cos(x) };
+		}
+
+		if constexpr (std::is_same_v< F32, T >) {
+			const auto [sin, cos] = SinCos(static_cast< F64 >(x), n);
+			return { static_cast< T >(sin), static_cast< T >(cos) };
+		}
+		else {
+			// The reduction below is exact for |x| < 2^20 pi/2 and degrades
+			// gradually beyond. Results for |x| >= 2^62 (or non-finite x) are
+			// meaningless in floating point.
+			if (!(Abs(x) < T(4.0e18))) {
+				const T nan = std::numeric_limits< T >::quiet_NaN();
+				return { nan, nan };
+			}
+
+			// x = k pi/2 + r, |r| <= pi/4
+			const T k = details::Round(x * (T(2) * std::numbers::inv_pi_v< T >));
+			const T r = (((x - k * T(details::g_pi_2_1)) - k * T(details::g_pi_2_2))
+						 - k * T(details::g_pi_2_3)) - k * T(details::g_pi_2_4);
+
+			// Evaluates the series of Sin and Cos in a single loop (sharing
+			// r^2). The leading terms r and 1 are added last to reduce the
+			// rounding errors.
+
+			const T r2 = Sqr(r);
+
+			T sin_old(-1);
+			T cos_old(-1);
+			T sin(0);
+			T cos(0);
+			T si(-r * r2 / T(6));
+			T ci(-r2 / T(2));
+			for (std::size_t i = 1u;
+				 i < n && !(Equal(sin_old, sin) && Equal(cos_old, cos)); ++i) {
+
+				sin_old = sin;
+				cos_old = cos;
+				sin += si;
+				cos += ci;
+				si *= -r2;
+				si /= ((T(2) * i + T(2)) * (T(2) * i + T(3)));
+				ci *= -r2;
+				ci /= ((T(2) * i + T(1)) * (T(2) * i + T(2)));
+			}
+
+			sin += r;
+			cos += T(1);
+
+			// Rotate by k quarter turns.
+			switch (static_cast< long long >(k) & 3) {
+			case 0:
+				return {  sin,  cos };
+			case 1:
+				return {  cos, -sin };
+			case 2:
+				return { -sin, -cos };
+			default:
+				return { -cos,  sin };
+			}
+		}
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr Integral< T, std::pair< F64, F64 > > SinCos(T x, std::size_t n) noexcept {
+		return SinCos(static_cast< F64 >(x), n);
+	}
+
+	//-------------------------------------------------------------------------
+	// float       Atan2(float y,       float x)       noexcept;
+	// double      Atan2(double y,      double x)      noexcept;
+	// long double Atan2(long double y, long double x) noexcept;
+	// double      Atan2(Integral y,    Integral x)    noexcept;
+	//-------------------------------------------------------------------------
+
+	namespace details {
+
+		/**
+		 Computes atan(t).
+
+		 @pre			t is in [0, 1].
+		 */
+		template< typename T >
+		[[nodiscard]]
+		constexpr T Atan(T t, std::size_t n) noexcept {
+			// atan(t) = 2 atan(t / (1 + sqrt(1 + t^2))), applied twice:
+			// t in [0, tan(pi/16)]
+			t /= T(1) + Sqrt(T(1) + Sqr(t), n);
+			t /= T(1) + Sqrt(T(1) + Sqr(t), n);
+
+			//                inf        t^(2*i+1)       inf
+			// atan(t) = t + sum (-1)^i --------- = t + sum ci
+			//                i=1         2*i+1          i=1
+
+			const T t2 = Sqr(t);
+
+			T sum_old(-1);
+			T sum(0);
+			T ti(-t * t2);
+			for (std::size_t i = 1u; i < n && !Equal(sum_old, sum); ++i) {
+				sum_old = sum;
+				sum += ti / (T(2) * i + T(1));
+				ti *= -t2;
+			}
+
+			return T(4) * (t + sum);
+		}
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr FloatingPoint< T > Atan2(T y, T x, std::size_t n) noexcept {
+		if (!std::is_constant_evaluated()) {
+			return std::atan2(y, x);
+		}
+
+		if constexpr (std::is_same_v< F32, T >) {
+			return static_cast< T >(Atan2(static_cast< F64 >(y), static_cast< F64 >(x), n));
+		}
+		else {
+			if (x != x || y != y) {
+				return std::numeric_limits< T >::quiet_NaN();
+			}
+
+			constexpr T pi_2 = T(0.5) * std::numbers::pi_v< T >;
+
+			// The angle in the first quadrant.
+			const T ax = Abs(x);
+			const T ay = Abs(y);
+			T angle;
+			if (std::numeric_limits< T >::infinity() == ax
+				&& std::numeric_limits< T >::infinity() == ay) {
+				angle = T(0.5) * pi_2;
+			}
+			else if (ay <= ax) {
+				angle = (T(0) == ay) ? T(0) : details::Atan(ay / ax, n);
+			}
+			else {
+				angle = pi_2 - details::Atan(ax / ay, n);
+			}
+
+			// Mirror into the quadrant of (x, y) (also for signed zeros).
+			if (details::SignBit(x)) {
+				angle = std::numbers::pi_v< T > - angle;
+			}
+			return details::SignBit(y) ? -angle : angle;
+		}
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr Integral< T, F64 > Atan2(T y, T x, std::size_t n) noexcept {
+		return Atan2(static_cast< F64 >(y), static_cast< F64 >(x), n);
+	}
+
 	//-------------------------------------------------------------------------
 	// float       Cos(float x)       noexcept;
 	// double      Cos(double x)      noexcept;
@@ -237,23 +662,11 @@ namespace maml {
 	template< typename T >
 	[[nodiscard]]
 	constexpr FloatingPoint< T > Cos(T x, std::size_t n) noexcept {
-		//          inf  (-1)^i            inf
-		// cos(x) = sum -------- x^(2*i) = sum ci
-		//          i=0  (2*i)!            i=0
-		
-		const T x2 = Sqr(x);
-
-		T sum_old(-1);
-		T sum(0);
-		T ci(1);
-		for (std::size_t i = 0u; i < n && !Equal(sum_old, sum); ++i) {
-			sum_old = sum;
-			sum += ci;
-			ci *= -x2;
-			ci /= ((T(2) * i + T(1)) * (T(2) * i + T(2)));
+		if (!std::is_constant_evaluated()) {
+			return std::cos(x);
 		}
-		
-		return sum;
+
+		return SinCos(x, n).second;
 	}
 
 	template< typename T >
@@ -272,23 +685,11 @@ namespace maml {
 	template< typename T >
 	[[nodiscard]]
 	constexpr FloatingPoint< T > Sin(T x, std::size_t n) noexcept {
-		//          inf  (-1)^i              inf
-		// sin(x) = sum -------- x^(2*i+1) = sum ci
-		//          i=0 (2*i+1)!             i=0
-		
-		const T x2 = Sqr(x);
-
-		T sum_old(-1);
-		T sum(0);
-		T ci(x);
-		for (std::size_t i = 0u; i < n && !Equal(sum_old, sum); ++i) {
-			sum_old = sum;
-			sum += ci;
-			ci *= -x2;
-			ci /= ((T(2) * i + T(2)) * (T(2) * i + T(3)));
+		if (!std::is_constant_evaluated()) {
+			return std::sin(x);
 		}
-		
-		return sum;
+
+		return SinCos(x, n).first;
 	}
 
 	template< typename T >
@@ -307,23 +708,22 @@ namespace maml {
 	template< typename T >
 	[[nodiscard]]
 	constexpr FloatingPoint< T > Cosh(T x, std::size_t n) noexcept {
-		//           inf  x^(2*i)   inf
-		// cosh(x) = sum -------- = sum ci
-		//           i=0  (2*i)!    i=0
-		
-		const T x2 = Sqr(x);
+		if (!std::is_constant_evaluated()) {
+			return std::cosh(x);
+		}
 
-		T sum_old(-1);
-		T sum(0);
-		T ci(1);
-		for (std::size_t i = 0u; i < n && !Equal(sum_old, sum); ++i) {
-			sum_old = sum;
-			sum += ci;
-			ci *= x2;
-			ci /= ((T(2) * i + T(1)) * (T(2) * i + T(2)));
+		const T ax = Abs(x);
+
+		// e^-|x| is negligible for large |x|: cosh(x) = e^|x| / 2
+		// = (e^(|x|/2) / 2) e^(|x|/2) (which does not overflow prematurely).
+		if (ax > T(std::numeric_limits< T >::digits) * std::numbers::ln2_v< T >) {
+			const T e = Exp(T(0.5) * ax, n);
+			return (T(0.5) * e) * e;
 		}
-		
-		return sum;
+
+		// cosh(x) = (e^|x| + e^-|x|) / 2
+		const T e = Exp(ax, n);
+		return T(0.5) * (e + T(1) / e);
 	}
 
 	template< typename T >
@@ -342,23 +742,43 @@ namespace maml {
 	template< typename T >
 	[[nodiscard]]
 	constexpr FloatingPoint< T > Sinh(T x, std::size_t n) noexcept {
-		//           inf x^(2*i+1)  inf
-		// sinh(x) = sum -------- = sum ci
-		//           i=0 (2*i+1)!   i=0
+		if (!std::is_constant_evaluated()) {
+			return std::sinh(x);
+		}
+
+		const T ax = Abs(x);
+
+		if (ax > T(std::numeric_limits< T >::digits) * std::numbers::ln2_v< T >) {
+			const T e = Exp(T(0.5) * ax, n);
+			const T sinh = (T(0.5) * e) * e;
+			return (T(0) <= x) ? sinh : -sinh;
+		}
+
+		// sinh(x) = (e^|x| - e^-|x|) / 2 suffers from cancellation for small
+		// |x|: use the (fast converging) series instead.
+		if (ax >= T(1)) {
+			const T e = Exp(ax, n);
+			const T sinh = T(0.5) * (e - T(1) / e);
+			return (T(0) <= x) ? sinh : -sinh;
+		}
+
+		//               inf x^(2*i+1)      inf
+		// sinh(x) = x + sum -------- = x + sum ci
+		//               i=1 (2*i+1)!       i=1
 		
 		const T x2 = Sqr(x);
 
 		T sum_old(-1);
 		T sum(0);
-		T ci(x);
-		for (std::size_t i = 0u; i < n && !Equal(sum_old, sum); ++i) {
+		T ci(x * x2 / T(6));
+		for (std::size_t i = 1u; i < n && !Equal(sum_old, sum); ++i) {
 			sum_old = sum;
 			sum += ci;
 			ci *= x2;
 			ci /= ((T(2) * i + T(2)) * (T(2) * i + T(3)));
 		}
 		
-		return sum;
+		return x + sum;
 	}
 
 	template< typename T >
@@ -366,4 +786,58 @@ namespace maml {
 	constexpr Integral< T, F64 > Sinh(T x, std::size_t n) noexcept {
 		return Sinh(static_cast< F64 >(x), n);
 	}
+
+	//-------------------------------------------------------------------------
+	// float       Atanh(float x)       noexcept;
+	// double      Atanh(double x)      noexcept;
+	// long double Atanh(long double x) noexcept;
+	// double      Atanh(Integral x)    noexcept;
+	//-------------------------------------------------------------------------
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr FloatingPoint< T > Atanh(T x, std::size_t n) noexcept {
+		if (!std::is_constant_evaluated()) {
+			return std::atanh(x);
+		}
+
+		using limits = std::numeric_limits< T >;
+
+		const T ax = Abs(x);
+		if (x != x || ax > T(1)) {
+			return limits::quiet_NaN();
+		}
+		if (T(1) == ax) {
+			return (T(0) < x) ? limits::infinity() : -limits::infinity();
+		}
+
+		// atanh(x) = ln((1 + x) / (1 - x)) / 2 suffers from cancellation for
+		// small |x|: use the (fast converging) series instead.
+		if (ax >= T(0.5)) {
+			return T(0.5) * Ln((T(1) + x) / (T(1) - x), n);
+		}
+
+		//                inf x^(2*i+1)      inf
+		// atanh(x) = x + sum -------- = x + sum ci
+		//                i=1  2*i+1         i=1
+
+		const T x2 = Sqr(x);
+
+		T sum_old(-1);
+		T sum(0);
+		T xi(x * x2);
+		for (std::size_t i = 1u; i < n && !Equal(sum_old, sum); ++i) {
+			sum_old = sum;
+			sum += xi / (T(2) * i + T(1));
+			xi *= x2;
+		}
+
+		return x + sum;
+	}
+
+	template< typename T >
+	[[nodiscard]]
+	constexpr Integral< T, F64 > Atanh(T x, std::size_t n) noexcept {
+		return Atanh(static_cast< F64 >(x), n);
+	}
 }
@@ -0,0 +1,868 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "algebra\complex.hpp"
+#include "simd\cpu.hpp"
+#include "simd\swizzle.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <immintrin.h>
+#include <numbers>
+#include <span>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	namespace details {
+
+		//---------------------------------------------------------------------
+		// FFT Lanes
+		//---------------------------------------------------------------------
+
+		// A lane holds one Complex< T > (scalar) or 2 (F32x4S) or 4 (F32x8S)
+		// interleaved C32 values (Re, Im, Re, Im, ...).
+		template< typename LaneT >
+		struct FFTLane;
+
+		template< typename T >
+		struct FFTLane< Complex< T > > {
+
+		public:
+
+			using ScalarT = T;
+
+			static constexpr std::size_t s_width = 1u;
+
+			[[nodiscard]]
+			static const Complex< T > Load(const Complex< T >* p) noexcept {
+				return *p;
+			}
+
+			static void Store(Complex< T >* p, const Complex< T >& v) noexcept {
+				*p = v;
+			}
+
+			[[nodiscard]]
+			static const Complex< T > Broadcast(const Complex< T >& c) noexcept {
+				return c;
+			}
+
+			[[nodiscard]]
+			static const Complex< T > Mul(const Complex< T >& a,
+										  const Complex< T >& b) noexcept {
+				return a * b;
+			}
+
+			[[nodiscard]]
+			static const Complex< T > Conjugate(const Complex< T >& a) noexcept {
+				return a.Conjugate();
+			}
+
+			// Forward: a * -i, Inverse: a * i
+			template< bool Inverse >
+			[[nodiscard]]
+			static const Complex< T > RotateQuarter(const Complex< T >& a) noexcept {
+				if constexpr (Inverse) {
+					return { -a.Im(), a.Re() };
+				}
+				else {
+					return { a.Im(), -a.Re() };
+				}
+			}
+		};
+
+		template<>
+		struct FFTLane< F32x4S > {
+
+		public:
+
+			using ScalarT = F32;
+
+			static constexpr std::size_t s_width = 2u;
+
+			[[nodiscard]]
+			static const F32x4S __vectorcall Load(const C32* p) noexcept {
+				return F32x4S::LoadUnaligned(p->data());
+			}
+
+			static void __vectorcall Store(C32* p, const F32x4S& v) noexcept {
+				v.StoreUnaligned(p->data());
+			}
+
+			[[nodiscard]]
+			static const F32x4S __vectorcall Broadcast(const C32& c) noexcept {
+				return { c.Re(), c.Im(), c.Re(), c.Im() };
+			}
+
+			[[nodiscard]]
+			MAML_TARGET_SSE4_1
+			static const F32x4S __vectorcall Mul(const F32x4S& a, const F32x4S& b) noexcept {
+				// (a.Re * b.Re - a.Im * b.Im, a.Im * b.Re + a.Re * b.Im)
+				const __m128 b_re = _mm_moveldup_ps(b.m_v);
+				const __m128 b_im = _mm_movehdup_ps(b.m_v);
+				const __m128 a_swap = Swizzle< 1u, 0u, 3u, 2u >(a).m_v;
+				#if defined(__FMA__) || defined(__AVX2__)
+				return _mm_fmaddsub_ps(a.m_v, b_re, _mm_mul_ps(a_swap, b_im));
+				#else
+				return _mm_addsub_ps(_mm_mul_ps(a.m_v, b_re), _mm_mul_ps(a_swap, b_im));
+				#endif
+			}
+
+			[[nodiscard]]
+			static const F32x4S __vectorcall Conjugate(const F32x4S& a) noexcept {
+				return _mm_xor_ps(a.m_v, _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f));
+			}
+
+			template< bool Inverse >
+			[[nodiscard]]
+			static const F32x4S __vectorcall RotateQuarter(const F32x4S& a) noexcept {
+				const __m128 sign = Inverse ? _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f)
+					                        : _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f);
+				return _mm_xor_ps(Swizzle< 1u, 0u, 3u, 2u >(a).m_v, sign);
+			}
+		};
+
+		#ifdef MAML_HAS_AVX2_VECTORS
+
+		template<>
+		struct FFTLane< F32x8S > {
+
+		public:
+
+			using ScalarT = F32;
+
+			static constexpr std::size_t s_width = 4u;
+
+			[[nodiscard]]
+			static const F32x8S __vectorcall Load(const C32* p) noexcept {
+				return F32x8S::LoadUnaligned(p->data());
+			}
+
+			static void __vectorcall Store(C32* p, const F32x8S& v) noexcept {
+				v.StoreUnaligned(p->data());
+			}
+
+			[[nodiscard]]
+			static const F32x8S __vectorcall Broadcast(const C32& c) noexcept {
+				return _mm256_setr_ps(c.Re(), c.Im(), c.Re(), c.Im(),
+									  c.Re(), c.Im(), c.Re(), c.Im());
+			}
+
+			[[nodiscard]]
+			static const F32x8S __vectorcall Mul(const F32x8S& a, const F32x8S& b) noexcept {
+				// (a.Re * b.Re - a.Im * b.Im, a.Im * b.Re + a.Re * b.Im)
+				const __m256 b_re = _mm256_moveldup_ps(b.m_v);
+				const __m256 b_im = _mm256_movehdup_ps(b.m_v);
+				const __m256 a_swap = _mm256_permute_ps(a.m_v, _MM_SHUFFLE(2, 3, 0, 1));
+				return _mm256_fmaddsub_ps(a.m_v, b_re, _mm256_mul_ps(a_swap, b_im));
+			}
+
+			[[nodiscard]]
+			static const F32x8S __vectorcall Conjugate(const F32x8S& a) noexcept {
+				const __m256 sign = _mm256_setr_ps(0.0f, -0.0f, 0.0f, -0.0f,
+												   0.0f, -0.0f, 0.0f, -0.0f);
+				return _mm256_xor_ps(a.m_v, sign);
+			}
+
+			template< bool Inverse >
+			[[nodiscard]]
+			static const F32x8S __vectorcall RotateQuarter(const F32x8S& a) noexcept {
+				const __m256 sign = Inverse
+					? _mm256_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f)
+					: _mm256_setr_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f);
+				const __m256 a_swap = _mm256_permute_ps(a.m_v, _MM_SHUFFLE(2, 3, 0, 1));
+				return _mm256_xor_ps(a_swap, sign);
+			}
+		};
+
+		#endif
+
+		//---------------------------------------------------------------------
+		// FFT Butterflies
+		//---------------------------------------------------------------------
+
+		// In-place DFT of size R of the given lanes (natural output order).
+		template< std::size_t R, bool Inverse, typename LaneT >
+		inline void Butterfly(LaneT* a) noexcept {
+			using Lane = FFTLane< LaneT >;
+
+			if constexpr (2u == R) {
+				const LaneT t = a[0u] - a[1u];
+				a[0u] = a[0u] + a[1u];
+				a[1u] = t;
+			}
+			else if constexpr (4u == R) {
+				const LaneT t0 = a[0u] + a[2u];
+				const LaneT t1 = a[0u] - a[2u];
+				const LaneT t2 = a[1u] + a[3u];
+				const LaneT t3 = Lane::template RotateQuarter< Inverse >(a[1u] - a[3u]);
+				a[0u] = t0 + t2;
+				a[1u] = t1 + t3;
+				a[2u] = t0 - t2;
+				a[3u] = t1 - t3;
+			}
+			else {
+				static_assert(8u == R);
+
+				// Two DFTs of size 4 of the even and odd lanes.
+				LaneT e[4u] = { a[0u], a[2u], a[4u], a[6u] };
+				LaneT o[4u] = { a[1u], a[3u], a[5u], a[7u] };
+				Butterfly< 4u, Inverse >(e);
+				Butterfly< 4u, Inverse >(o);
+
+				// o[k] *= w8^k with w8 = (1 -+ i) / sqrt(2)
+				using ScalarT = typename Lane::ScalarT;
+				constexpr ScalarT inv_sqrt2 = std::numbers::sqrt2_v< ScalarT > / ScalarT(2);
+				o[1u] = (o[1u] + Lane::template RotateQuarter< Inverse >(o[1u])) * inv_sqrt2;
+				o[2u] = Lane::template RotateQuarter< Inverse >(o[2u]);
+				o[3u] = Lane::template RotateQuarter< Inverse >(o[3u]);
+				o[3u] = (o[3u] + Lane::template RotateQuarter< Inverse >(o[3u])) * inv_sqrt2;
+
+				for (std::size_t k = 0u; k < 4u; ++k) {
+					a[k]      = e[k] + o[k];
+					a[k + 4u] = e[k] - o[k];
+				}
+			}
+		}
+
+		//---------------------------------------------------------------------
+		// FFT Stages
+		//---------------------------------------------------------------------
+
+		// One Stockham autosort stage of radix R for the sub-transforms of
+		// length n with stride s, vectorized over the stride:
+		// y[q + s (R p + j)] = w_n^(j p) sum_k x[q + s (p + k m)] w_R^(j k)
+		template< std::size_t R, bool Inverse, typename LaneT, typename T >
+		inline void RunStage(const Complex< T >* x, Complex< T >* y,
+							 std::size_t n, std::size_t s,
+							 const Complex< T >* twiddles) noexcept {
+			using Lane = FFTLane< LaneT >;
+
+			const std::size_t m = n / R;
+			for (std::size_t p = 0u; p < m; ++p) {
+				LaneT w[R];
+				for (std::size_t j = 1u; j < R; ++j) {
+					w[j] = Lane::Broadcast(twiddles[(j - 1u) * m + p]);
+					if constexpr (Inverse) {
+						w[j] = Lane::Conjugate(w[j]);
+					}
+				}
+
+				for (std::size_t q = 0u; q < s; q += Lane::s_width) {
+					LaneT a[R];
+					for (std::size_t k = 0u; k < R; ++k) {
+						a[k] = Lane::Load(x + q + s * (p + k * m));
+					}
+
+					Butterfly< R, Inverse >(a);
+
+					Lane::Store(y + q + s * R * p, a[0u]);
+					for (std::size_t j = 1u; j < R; ++j) {
+						Lane::Store(y + q + s * (R * p + j), Lane::Mul(a[j], w[j]));
+					}
+				}
+			}
+		}
+
+		// The first Stockham stage (s = 1) of radix R, vectorized over two
+		// consecutive butterflies p and p + 1.
+		template< std::size_t R, bool Inverse >
+		inline void RunFirstStage(const C32* x, C32* y, std::size_t n,
+								  const C32* twiddles) noexcept {
+			using Lane = FFTLane< F32x4S >;
+
+			const std::size_t m = n / R;
+			for (std::size_t p = 0u; p < m; p += 2u) {
+				F32x4S a[R];
+				for (std::size_t k = 0u; k < R; ++k) {
+					a[k] = Lane::Load(x + p + k * m);
+				}
+
+				Butterfly< R, Inverse >(a);
+
+				for (std::size_t j = 1u; j < R; ++j) {
+					F32x4S w = Lane::Load(twiddles + (j - 1u) * m + p);
+					if constexpr (Inverse) {
+						w = Lane::Conjugate(w);
+					}
+					a[j] = Lane::Mul(a[j], w);
+				}
+
+				// Transpose the outputs of butterflies p and p + 1.
+				for (std::size_t j = 0u; j < R; j += 2u) {
+					Lane::Store(y + R * p + j,        Shuffle< 0u, 1u, 4u, 5u >(a[j], a[j + 1u]));
+					Lane::Store(y + R * (p + 1u) + j, Shuffle< 2u, 3u, 6u, 7u >(a[j], a[j + 1u]));
+				}
+			}
+		}
+
+		// A Stockham stage of an arbitrary radix r (a naive DFT of size r per
+		// butterfly).
+		template< bool Inverse, typename T >
+		inline void RunGenericStage(const Complex< T >* x, Complex< T >* y,
+									std::size_t n, std::size_t s, std::size_t r,
+									const Complex< T >* twiddles,
+									const Complex< T >* roots,
+									Complex< T >* scratch) noexcept {
+			const std::size_t m = n / r;
+			for (std::size_t p = 0u; p < m; ++p) {
+				for (std::size_t q = 0u; q < s; ++q) {
+					for (std::size_t k = 0u; k < r; ++k) {
+						scratch[k] = x[q + s * (p + k * m)];
+					}
+
+					for (std::size_t j = 0u; j < r; ++j) {
+						Complex< T > sum = scratch[0u];
+						for (std::size_t k = 1u; k < r; ++k) {
+							const Complex< T >& w = roots[(j * k) % r];
+							sum += scratch[k] * (Inverse ? w.Conjugate() : w);
+						}
+
+						if (0u != j) {
+							const Complex< T >& w = twiddles[(j - 1u) * m + p];
+							sum = sum * (Inverse ? w.Conjugate() : w);
+						}
+						y[q + s * (r * p + j)] = sum;
+					}
+				}
+			}
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// FFTPlan
+	//-------------------------------------------------------------------------
+
+	/**
+	 A plan for complex-to-complex FFTs of a fixed size.
+
+	 The plan factorizes the size into radix-8, radix-4 and radix-2 stages
+	 followed by generic stages for the remaining (odd) prime factors, and
+	 precomputes all twiddle factors. The transforms use a Stockham
+	 autosort formulation (no bit reversal). For C32, the radix-2/4/8 stages
+	 use F32x4S/F32x8S butterflies depending on the SIMD level at the time
+	 the plan is created (see GetSIMDLevel).
+
+	 The generic stages cost O(n p) for a prime factor p, so sizes with large
+	 prime factors are slow. A plan owns scratch memory and must not be
+	 used by multiple threads concurrently.
+	 */
+	template< typename T >
+	class FFTPlan {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a plan for FFTs of the given size.
+
+		 @pre			@a size is not equal to zero.
+		 */
+		explicit FFTPlan(std::size_t size)
+			: m_size(size),
+			m_level(GetSIMDLevel()),
+			m_stages(),
+			m_twiddles(),
+			m_roots(),
+			m_work(size),
+			m_scratch() {
+
+			std::size_t max_radix = 0u;
+			std::size_t n = size;
+			for (const std::size_t radix : Factorize(size)) {
+				Stage stage = { radix, m_twiddles.size(), m_roots.size() };
+
+				// twiddles[(j - 1) m + p] = w_n^(j p) with w_n = exp(-2 pi i / n)
+				const std::size_t m = n / radix;
+				for (std::size_t j = 1u; j < radix; ++j) {
+					for (std::size_t p = 0u; p < m; ++p) {
+						m_twiddles.push_back(Root(j * p, n));
+					}
+				}
+
+				if (8u != radix && 4u != radix && 2u != radix) {
+					for (std::size_t k = 0u; k < radix; ++k) {
+						m_roots.push_back(Root(k, radix));
+					}
+					max_radix = std::max(max_radix, radix);
+				}
+
+				m_stages.push_back(stage);
+				n = m;
+			}
+
+			m_scratch.resize(max_radix);
+		}
+
+		FFTPlan(const FFTPlan& plan) = default;
+		FFTPlan(FFTPlan&& plan) noexcept = default;
+		~FFTPlan() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		FFTPlan& operator=(const FFTPlan& plan) = default;
+		FFTPlan& operator=(FFTPlan&& plan) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Computes the forward transform
+		 output[k] = sum_n input[n] exp(-2 pi i k n / size()).
+
+		 @pre			@a input and @a output contain size() elements.
+		 @pre			@a input and @a output are either identical or do not
+						overlap.
+		 */
+		void Forward(std::span< const Complex< T > > input,
+					 std::span< Complex< T > > output) noexcept {
+			Execute< false >(input.data(), output.data());
+		}
+
+		/**
+		 Computes the normalized inverse transform
+		 output[n] = 1 / size() sum_k input[k] exp(2 pi i k n / size()).
+
+		 @pre			@a input and @a output contain size() elements.
+		 @pre			@a input and @a output are either identical or do not
+						overlap.
+		 */
+		void Inverse(std::span< const Complex< T > > input,
+					 std::span< Complex< T > > output) noexcept {
+			Execute< true >(input.data(), output.data());
+
+			const T scale = T(1) / static_cast< T >(m_size);
+			for (auto& v : output.first(m_size)) {
+				v *= scale;
+			}
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		struct Stage {
+
+		public:
+
+			std::size_t m_radix;
+			std::size_t m_twiddle_offset;
+			std::size_t m_root_offset;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		static const std::vector< std::size_t > Factorize(std::size_t n) {
+			std::vector< std::size_t > factors;
+			while (0u == n % 8u) {
+				factors.push_back(8u);
+				n /= 8u;
+			}
+			if (0u == n % 4u) {
+				factors.push_back(4u);
+				n /= 4u;
+			}
+			if (0u == n % 2u) {
+				factors.push_back(2u);
+				n /= 2u;
+			}
+			for (std::size_t f = 3u; f * f <= n; f += 2u) {
+				while (0u == n % f) {
+					factors.push_back(f);
+					n /= f;
+				}
+			}
+			if (1u < n) {
+				factors.push_back(n);
+			}
+			return factors;
+		}
+
+		[[nodiscard]]
+		static const Complex< T > Root(std::size_t k, std::size_t n) noexcept {
+			// exp(-2 pi i k / n), evaluated in double precision.
+			const F64 angle = -2.0 * std::numbers::pi * static_cast< F64 >(k % n)
+				            / static_cast< F64 >(n);
+			return { static_cast< T >(std::cos(angle)), static_cast< T >(std::sin(angle)) };
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		template< bool Inverse >
+		void Execute(const Complex< T >* input, Complex< T >* output) noexcept {
+			const std::size_t nb_stages = m_stages.size();
+			if (0u == nb_stages) {
+				std::copy_n(input, m_size, output);
+				return;
+			}
+
+			// Ping-pong between the output and the work buffer, such that the
+			// last stage writes to the output.
+			Complex< T >* buffers[2u] = { output, m_work.data() };
+			std::size_t target = (1u == nb_stages % 2u) ? 0u : 1u;
+			if (input == output && 0u == target) {
+				std::copy_n(input, m_size, m_work.data());
+				input = m_work.data();
+			}
+
+			const Complex< T >* x = input;
+			std::size_t n = m_size;
+			std::size_t s = 1u;
+			for (const auto& stage : m_stages) {
+				Complex< T >* const y = buffers[target];
+				ExecuteStage< Inverse >(stage, x, y, n, s);
+				x = y;
+				target ^= 1u;
+				n /= stage.m_radix;
+				s *= stage.m_radix;
+			}
+		}
+
+		template< bool Inverse >
+		void ExecuteStage(const Stage& stage, const Complex< T >* x, Complex< T >* y,
+						  std::size_t n, std::size_t s) noexcept {
+			const Complex< T >* const twiddles = m_twiddles.data() + stage.m_twiddle_offset;
+			switch (stage.m_radix) {
+			case 8u:
+				ExecuteStage< 8u, Inverse >(x, y, n, s, twiddles);
+				break;
+			case 4u:
+				ExecuteStage< 4u, Inverse >(x, y, n, s, twiddles);
+				break;
+			case 2u:
+				ExecuteStage< 2u, Inverse >(x, y, n, s, twiddles);
+				break;
+			default:
+				details::RunGenericStage< Inverse >(x, y, n, s, stage.m_radix, twiddles,
+													m_roots.data() + stage.m_root_offset,
+													m_scratch.data());
+				break;
+			}
+		}
+
+		template< std::size_t R, bool Inverse >
+		void ExecuteStage(const Complex< T >* x, Complex< T >* y,
+						  std::size_t n, std::size_t s,
+						  const Complex< T >* twiddles) noexcept {
+			if constexpr (std::is_same_v< F32, T >) {
+				#ifdef MAML_HAS_AVX2_VECTORS
+				if (SIMDLevel::AVX2 <= m_level && 0u == s % 4u) {
+					details::RunStage< R, Inverse, F32x8S >(x, y, n, s, twiddles);
+					return;
+				}
+				#endif
+				if (SIMDLevel::SSE4_1 <= m_level && 0u == s % 2u) {
+					details::InvokeSSE4_1([&]() noexcept {
+						details::RunStage< R, Inverse, F32x4S >(x, y, n, s, twiddles);
+					});
+					return;
+				}
+				if (SIMDLevel::SSE4_1 <= m_level && 1u == s && 0u == (n / R) % 2u) {
+					details::InvokeSSE4_1([&]() noexcept {
+						details::RunFirstStage< R, Inverse >(x, y, n, twiddles);
+					});
+					return;
+				}
+			}
+
+			details::RunStage< R, Inverse, Complex< T > >(x, y, n, s, twiddles);
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		std::size_t m_size;
+		SIMDLevel m_level;
+		std::vector< Stage > m_stages;
+		std::vector< Complex< T > > m_twiddles;
+		std::vector< Complex< T > > m_roots;
+		std::vector< Complex< T > > m_work;
+		std::vector< Complex< T > > m_scratch;
+	};
+
+	//-------------------------------------------------------------------------
+	// RealFFTPlan
+	//-------------------------------------------------------------------------
+
+	/**
+	 A plan for real-to-complex FFTs of a fixed even size. The real input of
+	 size n is transformed as a complex FFT of size n/2 followed by a
+	 post-processing pass; only the n/2 + 1 non-redundant coefficients are
+	 produced.
+	 */
+	template< typename T >
+	class RealFFTPlan {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a plan for real FFTs of the given size.
+
+		 @pre			@a size is even and not equal to zero.
+		 */
+		explicit RealFFTPlan(std::size_t size)
+			: m_size(size),
+			m_plan(size / 2u),
+			m_twiddles(size / 2u + 1u),
+			m_work(size / 2u) {
+
+			// twiddles[k] = exp(-2 pi i k / n)
+			for (std::size_t k = 0u; k <= size / 2u; ++k) {
+				const F64 angle = -2.0 * std::numbers::pi * static_cast< F64 >(k)
+					            / static_cast< F64 >(size);
+				m_twiddles[k] = { static_cast< T >(std::cos(angle)),
+								  static_cast< T >(std::sin(angle)) };
+			}
+		}
+
+		RealFFTPlan(const RealFFTPlan& plan) = default;
+		RealFFTPlan(RealFFTPlan&& plan) noexcept = default;
+		~RealFFTPlan() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		RealFFTPlan& operator=(const RealFFTPlan& plan) = default;
+		RealFFTPlan& operator=(RealFFTPlan&& plan) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Computes the forward transform of the given real input.
+
+		 @pre			@a input contains size() elements.
+		 @pre			@a output contains size() / 2 + 1 elements.
+		 */
+		void Forward(std::span< const T > input,
+					 std::span< Complex< T > > output) noexcept {
+			// z[k] = input[2k] + i input[2k+1]
+			const auto z = std::span< const Complex< T > >(
+				reinterpret_cast< const Complex< T >* >(input.data()), m_size / 2u);
+			m_plan.Forward(z, m_work);
+
+			// E[k] = (Z[k] + conj(Z[h-k])) / 2
+			// O[k] = (Z[k] - conj(Z[h-k])) / 2i
+			// X[k] = E[k] + w^k O[k]
+			const std::size_t h = m_size / 2u;
+			for (std::size_t k = 0u; k <= h; ++k) {
+				const Complex< T > a = m_work[k % h];
+				const Complex< T > b = m_work[(h - k) % h].Conjugate();
+				const Complex< T > e = (a + b) * T(0.5);
+				const Complex< T > d = (a - b) * T(0.5);
+				const Complex< T > o(d.Im(), -d.Re());
+				output[k] = e + m_twiddles[k] * o;
+			}
+		}
+
+		/**
+		 Computes the normalized inverse transform of the given n/2 + 1
+		 coefficients into real output.
+
+		 @pre			@a input contains size() / 2 + 1 elements.
+		 @pre			@a output contains size() elements.
+		 */
+		void Inverse(std::span< const Complex< T > > input,
+					 std::span< T > output) noexcept {
+			// E[k] = (X[k] + conj(X[h-k])) / 2
+			// O[k] = (X[k] - conj(X[h-k])) conj(w^k) / 2
+			// Z[k] = E[k] + i O[k]
+			const std::size_t h = m_size / 2u;
+			for (std::size_t k = 0u; k < h; ++k) {
+				const Complex< T > a = input[k];
+				const Complex< T > b = input[h - k].Conjugate();
+				const Complex< T > e = (a + b) * T(0.5);
+				const Complex< T > o = (a - b) * m_twiddles[k].Conjugate() * T(0.5);
+				m_work[k] = { e.Re() - o.Im(), e.Im() + o.Re() };
+			}
+
+			const auto z = std::span< Complex< T > >(
+				reinterpret_cast< Complex< T >* >(output.data()), h);
+			m_plan.Inverse(m_work, z);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		std::size_t m_size;
+		FFTPlan< T > m_plan;
+		std::vector< Complex< T > > m_twiddles;
+		std::vector< Complex< T > > m_work;
+	};
+
+	//-------------------------------------------------------------------------
+	// FFTPlan2D
+	//-------------------------------------------------------------------------
+
+	/**
+	 A plan for 2-D complex-to-complex FFTs of a fixed row-major
+	 nb_rows x nb_columns size, computed as 1-D FFTs of all rows followed by
+	 1-D FFTs of all columns.
+	 */
+	template< typename T >
+	class FFTPlan2D {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a plan for 2-D FFTs of the given size.
+
+		 @pre			@a nb_rows and @a nb_columns are not equal to zero.
+		 */
+		FFTPlan2D(std::size_t nb_rows, std::size_t nb_columns)
+			: m_row_plan(nb_columns),
+			m_column_plan(nb_rows),
+			m_column(nb_rows) {}
+
+		FFTPlan2D(const FFTPlan2D& plan) = default;
+		FFTPlan2D(FFTPlan2D&& plan) noexcept = default;
+		~FFTPlan2D() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		FFTPlan2D& operator=(const FFTPlan2D& plan) = default;
+		FFTPlan2D& operator=(FFTPlan2D&& plan) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		std::size_t GetNumberOfRows() const noexcept {
+			return m_column_plan.size();
+		}
+
+		[[nodiscard]]
+		std::size_t GetNumberOfColumns() const noexcept {
+			return m_row_plan.size();
+		}
+
+		/**
+		 Computes the forward 2-D transform.
+
+		 @pre			@a input and @a output contain
+						GetNumberOfRows() * GetNumberOfColumns() elements.
+		 @pre			@a input and @a output are either identical or do not
+						overlap.
+		 */
+		void Forward(std::span< const Complex< T > > input,
+					 std::span< Complex< T > > output) noexcept {
+			Execute< false >(input, output);
+		}
+
+		/**
+		 Computes the normalized inverse 2-D transform.
+
+		 @pre			@a input and @a output contain
+						GetNumberOfRows() * GetNumberOfColumns() elements.
+		 @pre			@a input and @a output are either identical or do not
+						overlap.
+		 */
+		void Inverse(std::span< const Complex< T > > input,
+					 std::span< Complex< T > > output) noexcept {
+			Execute< true >(input, output);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		template< bool Inverse >
+		void Execute(std::span< const Complex< T > > input,
+					 std::span< Complex< T > > output) noexcept {
+			const std::size_t nb_rows    = GetNumberOfRows();
+			const std::size_t nb_columns = GetNumberOfColumns();
+
+			for (std::size_t r = 0u; r < nb_rows; ++r) {
+				const auto row_in  = input.subspan(r * nb_columns, nb_columns);
+				const auto row_out = output.subspan(r * nb_columns, nb_columns);
+				if constexpr (Inverse) {
+					m_row_plan.Inverse(row_in, row_out);
+				}
+				else {
+					m_row_plan.Forward(row_in, row_out);
+				}
+			}
+
+			for (std::size_t c = 0u; c < nb_columns; ++c) {
+				for (std::size_t r = 0u; r < nb_rows; ++r) {
+					m_column[r] = output[r * nb_columns + c];
+				}
+				if constexpr (Inverse) {
+					m_column_plan.Inverse(m_column, m_column);
+				}
+				else {
+					m_column_plan.Forward(m_column, m_column);
+				}
+				for (std::size_t r = 0u; r < nb_rows; ++r) {
+					output[r * nb_columns + c] = m_column[r];
+				}
+			}
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		FFTPlan< T > m_row_plan;
+		FFTPlan< T > m_column_plan;
+		std::vector< Complex< T > > m_column;
+	};
+}
@@ -0,0 +1,308 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "algebra\complex.hpp"
+#include "collection\soa.hpp"
+#include "simd\cpu.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <immintrin.h>
+#include <span>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	namespace details {
+
+		//---------------------------------------------------------------------
+		// Oscillator Lanes
+		//---------------------------------------------------------------------
+
+		// Uniform access to F32 (scalar), F32x4S and F32x8S lanes.
+
+		template< typename VectorT >
+		[[nodiscard]]
+		inline const VectorT __vectorcall LoadLane(const F32* p) noexcept {
+			if constexpr (std::is_same_v< F32, VectorT >) {
+				return *p;
+			}
+			else {
+				return VectorT::Load(p);
+			}
+		}
+
+		inline void __vectorcall StoreLane(F32 v, F32* p) noexcept {
+			*p = v;
+		}
+		inline void __vectorcall StoreLane(const F32x4S& v, F32* p) noexcept {
+			v.Store(p);
+		}
+		#ifdef MAML_HAS_AVX2_VECTORS
+		inline void __vectorcall StoreLane(const F32x8S& v, F32* p) noexcept {
+			v.Store(p);
+		}
+		#endif
+
+		[[nodiscard]]
+		inline F32 __vectorcall SumLanes(F32 v) noexcept {
+			return v;
+		}
+		[[nodiscard]]
+		inline F32 __vectorcall SumLanes(const F32x4S& v) noexcept {
+			return _mm_cvtss_f32(HorizontalSum(v).m_v);
+		}
+		#ifdef MAML_HAS_AVX2_VECTORS
+		[[nodiscard]]
+		inline F32 __vectorcall SumLanes(const F32x8S& v) noexcept {
+			return _mm256_cvtss_f32(HorizontalSum(v).m_v);
+		}
+		#endif
+	}
+
+	//-------------------------------------------------------------------------
+	// OscillatorBank
+	//-------------------------------------------------------------------------
+
+	/**
+	 A bank of sinusoidal oscillators driven by complex rotation recurrences.
+
+	 Each oscillator is a unit phasor z = (cos(phase), sin(phase)) that is
+	 advanced by one sample with z *= w, where w = (cos(frequency),
+	 sin(frequency)). The phasors are stored in structure-of-arrays layout
+	 and advanced with F32x8S (AVX2) or F32x4S (SSE2) complex multiplies
+	 depending on the active SIMD level (see GetSIMDLevel). Since the
+	 recurrence accumulates rounding errors in the magnitude, all phasors
+	 are normalized every renormalization period steps (see
+	 Complex::Normalize).
+	 */
+	class OscillatorBank {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a bank of the given number of oscillators. All
+		 oscillators start with a zero phase, a zero frequency and a unit
+		 amplitude.
+
+		 @pre			@a renormalization_period is not equal to zero.
+		 */
+		explicit OscillatorBank(std::size_t nb_oscillators,
+								std::size_t renormalization_period = 64u)
+			: m_oscillators(nb_oscillators),
+			m_renormalization_period(renormalization_period),
+			m_nb_steps(0u) {
+
+			// The padding oscillators are identities with a zero amplitude,
+			// so they can be processed along with the others.
+			for (std::size_t i = 0u; i < m_oscillators.capacity(); ++i) {
+				m_oscillators.data(s_re)[i]   = 1.0f;
+				m_oscillators.data(s_w_re)[i] = 1.0f;
+			}
+			for (std::size_t i = 0u; i < nb_oscillators; ++i) {
+				m_oscillators.data(s_amplitude)[i] = 1.0f;
+			}
+		}
+
+		OscillatorBank(const OscillatorBank& bank) = default;
+		OscillatorBank(OscillatorBank&& bank) noexcept = default;
+		~OscillatorBank() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		OscillatorBank& operator=(const OscillatorBank& bank) = default;
+		OscillatorBank& operator=(OscillatorBank&& bank) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_oscillators.size();
+		}
+
+		[[nodiscard]]
+		std::size_t GetRenormalizationPeriod() const noexcept {
+			return m_renormalization_period;
+		}
+
+		/**
+		 Returns the phasor (cos(phase), sin(phase)) of the oscillator with
+		 the given index.
+		 */
+		[[nodiscard]]
+		const C32 GetPhasor(std::size_t index) const noexcept {
+			return { m_oscillators.data(s_re)[index], m_oscillators.data(s_im)[index] };
+		}
+
+		/**
+		 Sets the phase (in radians) of the oscillator with the given index.
+		 */
+		void SetPhase(std::size_t index, F32 phase) noexcept {
+			const F64 phi = static_cast< F64 >(phase);
+			m_oscillators.data(s_re)[index] = static_cast< F32 >(std::cos(phi));
+			m_oscillators.data(s_im)[index] = static_cast< F32 >(std::sin(phi));
+		}
+
+		/**
+		 Sets the frequency (in radians per step, i.e. 2 pi f / sample rate)
+		 of the oscillator with the given index. The phase is preserved.
+		 */
+		void SetFrequency(std::size_t index, F32 frequency) noexcept {
+			const F64 omega = static_cast< F64 >(frequency);
+			m_oscillators.data(s_w_re)[index] = static_cast< F32 >(std::cos(omega));
+			m_oscillators.data(s_w_im)[index] = static_cast< F32 >(std::sin(omega));
+		}
+
+		[[nodiscard]]
+		F32 GetAmplitude(std::size_t index) const noexcept {
+			return m_oscillators.data(s_amplitude)[index];
+		}
+
+		void SetAmplitude(std::size_t index, F32 amplitude) noexcept {
+			m_oscillators.data(s_amplitude)[index] = amplitude;
+		}
+
+		/**
+		 Advances all oscillators by the given number of steps.
+		 */
+		void Advance(std::size_t nb_steps = 1u) noexcept {
+			Dispatch< false >(nullptr, nb_steps);
+		}
+
+		/**
+		 Renders output.size() samples: each sample is the sum of
+		 amplitude * sin(phase) over all oscillators, after which all
+		 oscillators are advanced by one step.
+		 */
+		void Render(std::span< F32 > output) noexcept {
+			Dispatch< true >(output.data(), output.size());
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		template< bool RenderV >
+		void Dispatch(F32* output, std::size_t nb_steps) noexcept {
+			const SIMDLevel level = GetSIMDLevel();
+			#ifdef MAML_HAS_AVX2_VECTORS
+			if (SIMDLevel::AVX2 <= level) {
+				Process< RenderV, F32x8S >(output, nb_steps);
+				return;
+			}
+			#endif
+			if (SIMDLevel::SSE2 <= level) {
+				Process< RenderV, F32x4S >(output, nb_steps);
+			}
+			else {
+				Process< RenderV, F32 >(output, nb_steps);
+			}
+		}
+
+		template< bool RenderV, typename VectorT >
+		void Process(F32* output, std::size_t nb_steps) noexcept {
+			constexpr std::size_t s_width = sizeof(VectorT) / sizeof(F32);
+
+			// The samples are rendered in blocks: each oscillator chunk stays
+			// in registers for a whole block and adds its contribution to
+			// the block's per-sample accumulators.
+			VectorT sums[s_block_size];
+
+			for (std::size_t s0 = 0u; s0 < nb_steps; s0 += s_block_size) {
+				const std::size_t block_size = std::min(s_block_size, nb_steps - s0);
+
+				if constexpr (RenderV) {
+					for (std::size_t s = 0u; s < block_size; ++s) {
+						sums[s] = VectorT(0.0f);
+					}
+				}
+
+				std::size_t count = m_nb_steps;
+				for (std::size_t i = 0u; i < m_oscillators.size(); i += s_width) {
+					Complex< VectorT > z(details::LoadLane< VectorT >(m_oscillators.data(s_re) + i),
+										 details::LoadLane< VectorT >(m_oscillators.data(s_im) + i));
+					const Complex< VectorT > w(details::LoadLane< VectorT >(m_oscillators.data(s_w_re) + i),
+											   details::LoadLane< VectorT >(m_oscillators.data(s_w_im) + i));
+					const VectorT amplitude = details::LoadLane< VectorT >(m_oscillators.data(s_amplitude) + i);
+
+					count = m_nb_steps;
+					for (std::size_t s = 0u; s < block_size; ++s) {
+						if constexpr (RenderV) {
+							sums[s] += amplitude * z.Im();
+						}
+
+						z *= w;
+
+						if (++count == m_renormalization_period) {
+							z.Normalize();
+							count = 0u;
+						}
+					}
+
+					details::StoreLane(z.Re(), m_oscillators.data(s_re) + i);
+					details::StoreLane(z.Im(), m_oscillators.data(s_im) + i);
+				}
+
+				// All chunks share the same step count.
+				m_nb_steps = count;
+
+				if constexpr (RenderV) {
+					for (std::size_t s = 0u; s < block_size; ++s) {
+						output[s0 + s] = details::SumLanes(sums[s]);
+					}
+				}
+			}
+		}
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		static constexpr std::size_t s_block_size = 64u;
+
+		static constexpr std::size_t s_re        = 0u;
+		static constexpr std::size_t s_im        = 1u;
+		static constexpr std::size_t s_w_re      = 2u;
+		static constexpr std::size_t s_w_im      = 3u;
+		static constexpr std::size_t s_amplitude = 4u;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The phasors, rotations and amplitudes of the oscillators.
+		 */
+		SoA< Array< F32, 5u > > m_oscillators;
+
+		std::size_t m_renormalization_period;
+
+		/**
+		 The number of steps since the last renormalization.
+		 */
+		std::size_t m_nb_steps;
+	};
+}
@@ -0,0 +1,333 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "algebra\complex.hpp"
+#include "algebra\dual.hpp"
+#include "algebra\hyperbolic.hpp"
+#include "simd\cpu.hpp"
+#include "simd\math.hpp"
+#include "simd\swizzle.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <immintrin.h>
+#include <span>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	//-------------------------------------------------------------------------
+	// Type Declarations and Definitions
+	//-------------------------------------------------------------------------
+
+	// Packets of 4 (x4S) or 8 (x8S) complex, dual and hyperbolic numbers in
+	// structure-of-arrays layout: Re() holds all real parts and Im()/Du()
+	// all imaginary/dual parts.
+
+	using C32x4S = Complex< F32x4S >;
+	using D32x4S = Dual< F32x4S >;
+	using H32x4S = Hyperbolic< F32x4S >;
+
+	static_assert(sizeof(C32x4S) == 2u * sizeof(F32x4S));
+
+	#ifdef MAML_HAS_AVX2_VECTORS
+	using C32x8S = Complex< F32x8S >;
+	using D32x8S = Dual< F32x8S >;
+	using H32x8S = Hyperbolic< F32x8S >;
+
+	static_assert(sizeof(C32x8S) == 2u * sizeof(F32x8S));
+	#endif
+
+	//-------------------------------------------------------------------------
+	// Load and Store
+	//-------------------------------------------------------------------------
+
+	namespace details {
+
+		template< typename T, typename VectorT >
+		struct RebindAlgebra;
+
+		template< typename T, typename VectorT >
+		struct RebindAlgebra< Complex< T >, VectorT > {
+
+		public:
+
+			using type = Complex< VectorT >;
+		};
+
+		template< typename T, typename VectorT >
+		struct RebindAlgebra< Dual< T >, VectorT > {
+
+		public:
+
+			using type = Dual< VectorT >;
+		};
+
+		template< typename T, typename VectorT >
+		struct RebindAlgebra< Hyperbolic< T >, VectorT > {
+
+		public:
+
+			using type = Hyperbolic< VectorT >;
+		};
+
+		// (a0 b0 a1 b1 ...) -> (a0 a1 ...), (b0 b1 ...)
+
+		inline void __vectorcall Deinterleave(const F32* p, F32x4S& a, F32x4S& b) noexcept {
+			const F32x4S v0 = F32x4S::LoadUnaligned(p);
+			const F32x4S v1 = F32x4S::LoadUnaligned(p + 4u);
+			a = Shuffle< 0u, 2u, 4u, 6u >(v0, v1);
+			b = Shuffle< 1u, 3u, 5u, 7u >(v0, v1);
+		}
+
+		#ifdef MAML_HAS_AVX2_VECTORS
+		inline void __vectorcall Deinterleave(const F32* p, F32x8S& a, F32x8S& b) noexcept {
+			const __m256 v0 = _mm256_loadu_ps(p);
+			const __m256 v1 = _mm256_loadu_ps(p + 8u);
+			// (a0 a1 a4 a5 | a2 a3 a6 a7)
+			const __m256 a_ = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+			const __m256 b_ = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+			a = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(a_), _MM_SHUFFLE(3, 1, 2, 0)));
+			b = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(b_), _MM_SHUFFLE(3, 1, 2, 0)));
+		}
+		#endif
+
+		// (a0 a1 ...), (b0 b1 ...) -> (a0 b0 a1 b1 ...)
+
+		inline void __vectorcall Interleave(const F32x4S& a, const F32x4S& b, F32* p) noexcept {
+			Shuffle< 0u, 4u, 1u, 5u >(a, b).StoreUnaligned(p);
+			Shuffle< 2u, 6u, 3u, 7u >(a, b).StoreUnaligned(p + 4u);
+		}
+
+		#ifdef MAML_HAS_AVX2_VECTORS
+		inline void __vectorcall Interleave(const F32x8S& a, const F32x8S& b, F32* p) noexcept {
+			// (a0 b0 a1 b1 | a4 b4 a5 b5) and (a2 b2 a3 b3 | a6 b6 a7 b7)
+			const __m256 lo = _mm256_unpacklo_ps(a.m_v, b.m_v);
+			const __m256 hi = _mm256_unpackhi_ps(a.m_v, b.m_v);
+			_mm256_storeu_ps(p,      _mm256_permute2f128_ps(lo, hi, 0x20));
+			_mm256_storeu_ps(p + 8u, _mm256_permute2f128_ps(lo, hi, 0x31));
+		}
+		#endif
+	}
+
+	/**
+	 Loads a packet from the first 4 (F32x4S) or 8 (F32x8S) elements of the
+	 given span of C32, D32 or H32 elements. The element type is given
+	 explicitly (e.g. LoadPacket< C32, F32x8S >(values)), so contiguous
+	 containers convert to the span implicitly.
+
+	 @pre			@a values contains at least as many elements as the
+					packet width.
+	 */
+	template< typename AlgebraT, typename VectorT = F32x4S >
+	[[nodiscard]]
+	inline const typename details::RebindAlgebra< AlgebraT, VectorT >::type
+		__vectorcall LoadPacket(std::span< const std::type_identity_t< AlgebraT > > values) noexcept {
+
+		static_assert(sizeof(AlgebraT) == 2u * sizeof(F32));
+
+		VectorT a, b;
+		details::Deinterleave(values.data()->data(), a, b);
+		return { a, b };
+	}
+
+	/**
+	 Stores the given packet to the first 4 (F32x4S) or 8 (F32x8S) elements
+	 of the given span of C32, D32 or H32 elements.
+
+	 @pre			@a values contains at least as many elements as the
+					packet width.
+	 */
+	template< typename VectorT >
+	inline void __vectorcall StorePacket(const Complex< VectorT >& packet,
+										 std::span< C32 > values) noexcept {
+
+		details::Interleave(packet.Re(), packet.Im(), values.data()->data());
+	}
+
+	template< typename VectorT >
+	inline void __vectorcall StorePacket(const Dual< VectorT >& packet,
+										 std::span< D32 > values) noexcept {
+
+		details::Interleave(packet.Re(), packet.Du(), values.data()->data());
+	}
+
+	template< typename VectorT >
+	inline void __vectorcall StorePacket(const Hyperbolic< VectorT >& packet,
+										 std::span< H32 > values) noexcept {
+
+		details::Interleave(packet.Re(), packet.Im(), values.data()->data());
+	}
+
+	//-------------------------------------------------------------------------
+	// Polar Conversion
+	//-------------------------------------------------------------------------
+
+	namespace details {
+
+		template< typename VectorT >
+		inline void ToPolar(const C32* values, F32* r, F32* phi, std::size_t n) noexcept {
+			std::size_t i = 0u;
+			if constexpr (!std::is_void_v< VectorT >) {
+				constexpr std::size_t s_width = sizeof(VectorT) / sizeof(F32);
+				for (; i + s_width <= n; i += s_width) {
+					VectorT re, im;
+					Deinterleave(values[i].data(), re, im);
+					Sqrt(re * re + im * im).StoreUnaligned(r + i);
+					Atan2(im, re).StoreUnaligned(phi + i);
+				}
+			}
+
+			for (; i < n; ++i) {
+				r[i]   = values[i].Abs();
+				phi[i] = values[i].Arg();
+			}
+		}
+
+		template< typename VectorT >
+		inline void FromPolar(const F32* r, const F32* phi, C32* values, std::size_t n) noexcept {
+			std::size_t i = 0u;
+			if constexpr (!std::is_void_v< VectorT >) {
+				constexpr std::size_t s_width = sizeof(VectorT) / sizeof(F32);
+				for (; i + s_width <= n; i += s_width) {
+					const VectorT magnitude = VectorT::LoadUnaligned(r + i);
+					const auto [sin, cos] = SinCos(VectorT::LoadUnaligned(phi + i));
+					Interleave(magnitude * cos, magnitude * sin, values[i].data());
+				}
+			}
+
+			for (; i < n; ++i) {
+				values[i] = { r[i] * std::cos(phi[i]), r[i] * std::sin(phi[i]) };
+			}
+		}
+	}
+
+	/**
+	 Converts the given complex numbers to polar coordinates with the kernel
+	 of the active SIMD level (SSE4.1 or higher is vectorized).
+
+	 @pre			@a r and @a phi are at least as large as @a values.
+	 @param[in]		values
+					The complex numbers.
+	 @param[out]	r
+					The magnitudes of the given complex numbers.
+	 @param[out]	phi
+					The arguments (in [-pi, pi]) of the given complex numbers.
+	 */
+	inline void ToPolar(std::span< const C32 > values,
+						std::span< F32 > r, std::span< F32 > phi) noexcept {
+
+		const SIMDLevel level = GetSIMDLevel();
+		#ifdef MAML_HAS_AVX2_VECTORS
+		if (SIMDLevel::AVX2 <= level) {
+			details::ToPolar< F32x8S >(values.data(), r.data(), phi.data(), values.size());
+			return;
+		}
+		#endif
+		if (SIMDLevel::SSE4_1 <= level) {
+			details::InvokeSSE4_1([&]() noexcept {
+				details::ToPolar< F32x4S >(values.data(), r.data(), phi.data(), values.size());
+			});
+		}
+		else {
+			details::ToPolar< void >(values.data(), r.data(), phi.data(), values.size());
+		}
+	}
+
+	/**
+	 Converts the given polar coordinates to complex numbers with the kernel
+	 of the active SIMD level (SSE4.1 or higher is vectorized).
+
+	 @pre			@a r and @a phi have the same size.
+	 @pre			@a values is at least as large as @a r.
+	 @param[in]		r
+					The magnitudes.
+	 @param[in]		phi
+					The arguments.
+	 @param[out]	values
+					The complex numbers.
+	 */
+	inline void FromPolar(std::span< const F32 > r, std::span< const F32 > phi,
+						  std::span< C32 > values) noexcept {
+
+		const SIMDLevel level = GetSIMDLevel();
+		#ifdef MAML_HAS_AVX2_VECTORS
+		if (SIMDLevel::AVX2 <= level) {
+			details::FromPolar< F32x8S >(r.data(), phi.data(), values.data(), r.size());
+			return;
+		}
+		#endif
+		if (SIMDLevel::SSE4_1 <= level) {
+			details::InvokeSSE4_1([&]() noexcept {
+				details::FromPolar< F32x4S >(r.data(), phi.data(), values.data(), r.size());
+			});
+		}
+		else {
+			details::FromPolar< void >(r.data(), phi.data(), values.data(), r.size());
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// Lorentz Boosts
+	//-------------------------------------------------------------------------
+
+	namespace details {
+
+		template< typename VectorT >
+		inline void Boost(H32* events, const H32& boost, std::size_t n) noexcept {
+			std::size_t i = 0u;
+			if constexpr (!std::is_void_v< VectorT >) {
+				constexpr std::size_t s_width = sizeof(VectorT) / sizeof(F32);
+				const Hyperbolic< VectorT > b(VectorT(boost.Re()), VectorT(boost.Im()));
+				for (; i + s_width <= n; i += s_width) {
+					VectorT t, x;
+					Deinterleave(events[i].data(), t, x);
+					const Hyperbolic< VectorT > event = maml::Boost(Hyperbolic< VectorT >(t, x), b);
+					Interleave(event.Re(), event.Im(), events[i].data());
+				}
+			}
+
+			for (; i < n; ++i) {
+				events[i] = maml::Boost(events[i], boost);
+			}
+		}
+	}
+
+	/**
+	 Applies the given boost to the given events (t, x) with the kernel of
+	 the active SIMD level.
+
+	 @param[in,out]	events
+					The events.
+	 @param[in]		boost
+					The boost (see Hyperbolic::FromRapidity).
+	 */
+	inline void Boost(std::span< H32 > events, const H32& boost) noexcept {
+		const SIMDLevel level = GetSIMDLevel();
+		#ifdef MAML_HAS_AVX2_VECTORS
+		if (SIMDLevel::AVX2 <= level) {
+			details::Boost< F32x8S >(events.data(), boost, events.size());
+			return;
+		}
+		#endif
+		if (SIMDLevel::SSE2 <= level) {
+			details::Boost< F32x4S >(events.data(), boost, events.size());
+		}
+		else {
+			details::Boost< void >(events.data(), boost, events.size());
+		}
+	}
+}
@@ -0,0 +1,360 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "simd\cpu.hpp"
+#include "simd\target.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <immintrin.h>
+#include <span>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	namespace details {
+
+		//---------------------------------------------------------------------
+		// Batch Kernels
+		//---------------------------------------------------------------------
+
+		struct BatchKernels {
+
+		public:
+
+			F32 (*m_sum)(const F32* a, std::size_t n) noexcept;
+			F32 (*m_dot)(const F32* a, const F32* b, std::size_t n) noexcept;
+			void (*m_mul_add)(const F32* a, F32 s, F32 t,
+							  F32* result, std::size_t n) noexcept;
+			void (*m_f64_to_f32)(const F64* a, F32* result, std::size_t n) noexcept;
+			void (*m_f32_to_f64)(const F32* a, F64* result, std::size_t n) noexcept;
+		};
+
+		namespace scalar {
+
+			inline F32 Sum(const F32* a, std::size_t n) noexcept {
+				F32 sum = 0.0f;
+				for (std::size_t i = 0u; i < n; ++i) {
+					sum += a[i];
+				}
+				return sum;
+			}
+
+			inline F32 Dot(const F32* a, const F32* b, std::size_t n) noexcept {
+				F32 sum = 0.0f;
+				for (std::size_t i = 0u; i < n; ++i) {
+					sum += a[i] * b[i];
+				}
+				return sum;
+			}
+
+			inline void MulAdd(const F32* a, F32 s, F32 t,
+							   F32* result, std::size_t n) noexcept {
+				for (std::size_t i = 0u; i < n; ++i) {
+					result[i] = a[i] * s + t;
+				}
+			}
+
+			inline void Convert(const F64* a, F32* result, std::size_t n) noexcept {
+				for (std::size_t i = 0u; i < n; ++i) {
+					result[i] = static_cast< F32 >(a[i]);
+				}
+			}
+
+			inline void Convert(const F32* a, F64* result, std::size_t n) noexcept {
+				for (std::size_t i = 0u; i < n; ++i) {
+					result[i] = static_cast< F64 >(a[i]);
+				}
+			}
+		}
+
+		namespace sse2 {
+
+			[[nodiscard]]
+			inline F32 __vectorcall HorizontalSum(__m128 v) noexcept {
+				const __m128 v2 = _mm_add_ps(v, _mm_movehl_ps(v, v));
+				const __m128 v1 = _mm_add_ss(v2, _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(1, 1, 1, 1)));
+				return _mm_cvtss_f32(v1);
+			}
+
+			inline F32 Sum(const F32* a, std::size_t n) noexcept {
+				const std::size_t m = n & ~std::size_t(3u);
+				__m128 sum = _mm_setzero_ps();
+				for (std::size_t i = 0u; i < m; i += 4u) {
+					sum = _mm_add_ps(sum, _mm_loadu_ps(a + i));
+				}
+				return HorizontalSum(sum) + scalar::Sum(a + m, n - m);
+			}
+
+			inline F32 Dot(const F32* a, const F32* b, std::size_t n) noexcept {
+				const std::size_t m = n & ~std::size_t(3u);
+				__m128 sum = _mm_setzero_ps();
+				for (std::size_t i = 0u; i < m; i += 4u) {
+					const __m128 ab = _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i));
+					sum = _mm_add_ps(sum, ab);
+				}
+				return HorizontalSum(sum) + scalar::Dot(a + m, b + m, n - m);
+			}
+
+			inline void MulAdd(const F32* a, F32 s, F32 t,
+							   F32* result, std::size_t n) noexcept {
+				const std::size_t m = n & ~std::size_t(3u);
+				const __m128 s4 = _mm_set_ps1(s);
+				const __m128 t4 = _mm_set_ps1(t);
+				for (std::size_t i = 0u; i < m; i += 4u) {
+					const __m128 v = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a + i), s4), t4);
+					_mm_storeu_ps(result + i, v);
+				}
+				scalar::MulAdd(a + m, s, t, result + m, n - m);
+			}
+
+			inline void Convert(const F64* a, F32* result, std::size_t n) noexcept {
+				const std::size_t m = n & ~std::size_t(3u);
+				for (std::size_t i = 0u; i < m; i += 4u) {
+					const __m128 lo = _mm_cvtpd_ps(_mm_loadu_pd(a + i));
+					const __m128 hi = _mm_cvtpd_ps(_mm_loadu_pd(a + i + 2u));
+					_mm_storeu_ps(result + i, _mm_movelh_ps(lo, hi));
+				}
+				scalar::Convert(a + m, result + m, n - m);
+			}
+
+			inline void Convert(const F32* a, F64* result, std::size_t n) noexcept {
+				const std::size_t m = n & ~std::size_t(3u);
+				for (std::size_t i = 0u; i < m; i += 4u) {
+					const __m128 v = _mm_loadu_ps(a + i);
+					_mm_storeu_pd(result + i,      _mm_cvtps_pd(v));
+					_mm_storeu_pd(result + i + 2u, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+				}
+				scalar::Convert(a + m, result + m, n - m);
+			}
+		}
+
+		namespace avx2 {
+
+			[[nodiscard]]
+			MAML_TARGET_AVX2
+			inline F32 __vectorcall HorizontalSum(__m256 v) noexcept {
+				const __m128 lo = _mm256_castps256_ps128(v);
+				const __m128 hi = _mm256_extractf128_ps(v, 1);
+				return sse2::HorizontalSum(_mm_add_ps(lo, hi));
+			}
+
+			MAML_TARGET_AVX2
+			inline F32 Sum(const F32* a, std::size_t n) noexcept {
+				const std::size_t m = n & ~std::size_t(7u);
+				__m256 sum = _mm256_setzero_ps();
+				for (std::size_t i = 0u; i < m; i += 8u) {
+					sum = _mm256_add_ps(sum, _mm256_loadu_ps(a + i));
+				}
+				return HorizontalSum(sum) + scalar::Sum(a + m, n - m);
+			}
+
+			MAML_TARGET_AVX2
+			inline F32 Dot(const F32* a, const F32* b, std::size_t n) noexcept {
+				const std::size_t m = n & ~std::size_t(7u);
+				__m256 sum = _mm256_setzero_ps();
+				for (std::size_t i = 0u; i < m; i += 8u) {
+					sum = _mm256_fmadd_ps(_mm256_loadu_ps(a + i),
+										  _mm256_loadu_ps(b + i), sum);
+				}
+				return HorizontalSum(sum) + scalar::Dot(a + m, b + m, n - m);
+			}
+
+			MAML_TARGET_AVX2
+			inline void MulAdd(const F32* a, F32 s, F32 t,
+							   F32* result, std::size_t n) noexcept {
+				const std::size_t m = n & ~std::size_t(7u);
+				const __m256 s8 = _mm256_set1_ps(s);
+				const __m256 t8 = _mm256_set1_ps(t);
+				for (std::size_t i = 0u; i < m; i += 8u) {
+					const __m256 v = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), s8, t8);
+					_mm256_storeu_ps(result + i, v);
+				}
+				scalar::MulAdd(a + m, s, t, result + m, n - m);
+			}
+
+			MAML_TARGET_AVX2
+			inline void Convert(const F64* a, F32* result, std::size_t n) noexcept {
+				const std::size_t m = n & ~std::size_t(3u);
+				for (std::size_t i = 0u; i < m; i += 4u) {
+					_mm_storeu_ps(result + i, _mm256_cvtpd_ps(_mm256_loadu_pd(a + i)));
+				}
+				scalar::Convert(a + m, result + m, n - m);
+			}
+
+			MAML_TARGET_AVX2
+			inline void Convert(const F32* a, F64* result, std::size_t n) noexcept {
+				const std::size_t m = n & ~std::size_t(3u);
+				for (std::size_t i = 0u; i < m; i += 4u) {
+					_mm256_storeu_pd(result + i, _mm256_cvtps_pd(_mm_loadu_ps(a + i)));
+				}
+				scalar::Convert(a + m, result + m, n - m);
+			}
+		}
+
+		namespace avx512 {
+
+			MAML_TARGET_AVX512
+			inline F32 Sum(const F32* a, std::size_t n) noexcept {
+				const std::size_t m = n & ~std::size_t(15u);
+				__m512 sum = _mm512_setzero_ps();
+				for (std::size_t i = 0u; i < m; i += 16u) {
+					sum = _mm512_add_ps(sum, _mm512_loadu_ps(a + i));
+				}
+				return _mm512_reduce_add_ps(sum) + avx2::Sum(a + m, n - m);
+			}
+
+			MAML_TARGET_AVX512
+			inline F32 Dot(const F32* a, const F32* b, std::size_t n) noexcept {
+				const std::size_t m = n & ~std::size_t(15u);
+				__m512 sum = _mm512_setzero_ps();
+				for (std::size_t i = 0u; i < m; i += 16u) {
+					sum = _mm512_fmadd_ps(_mm512_loadu_ps(a + i),
+										  _mm512_loadu_ps(b + i), sum);
+				}
+				return _mm512_reduce_add_ps(sum) + avx2::Dot(a + m, b + m, n - m);
+			}
+
+			MAML_TARGET_AVX512
+			inline void MulAdd(const F32* a, F32 s, F32 t,
+							   F32* result, std::size_t n) noexcept {
+				const std::size_t m = n & ~std::size_t(15u);
+				const __m512 s16 = _mm512_set1_ps(s);
+				const __m512 t16 = _mm512_set1_ps(t);
+				for (std::size_t i = 0u; i < m; i += 16u) {
+					const __m512 v = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), s16, t16);
+					_mm512_storeu_ps(result + i, v);
+				}
+				avx2::MulAdd(a + m, s, t, result + m, n - m);
+			}
+
+			MAML_TARGET_AVX512
+			inline void Convert(const F64* a, F32* result, std::size_t n) noexcept {
+				const std::size_t m = n & ~std::size_t(7u);
+				for (std::size_t i = 0u; i < m; i += 8u) {
+					_mm256_storeu_ps(result + i, _mm512_cvtpd_ps(_mm512_loadu_pd(a + i)));
+				}
+				avx2::Convert(a + m, result + m, n - m);
+			}
+
+			MAML_TARGET_AVX512
+			inline void Convert(const F32* a, F64* result, std::size_t n) noexcept {
+				const std::size_t m = n & ~std::size_t(7u);
+				for (std::size_t i = 0u; i < m; i += 8u) {
+					_mm512_storeu_pd(result + i, _mm512_cvtps_pd(_mm256_loadu_ps(a + i)));
+				}
+				avx2::Convert(a + m, result + m, n - m);
+			}
+		}
+
+		#define MAML_BATCH_KERNELS(ns) \
+			BatchKernels{ &ns::Sum, &ns::Dot, &ns::MulAdd, &ns::Convert, &ns::Convert }
+
+		[[nodiscard]]
+		inline const BatchKernels& GetBatchKernels() noexcept {
+			// SSE4.1 does not provide anything beyond SSE2 for these kernels.
+			static const BatchKernels s_kernels[] = {
+				MAML_BATCH_KERNELS(scalar),
+				MAML_BATCH_KERNELS(sse2),
+				MAML_BATCH_KERNELS(sse2),
+				MAML_BATCH_KERNELS(avx2),
+				MAML_BATCH_KERNELS(avx512)
+			};
+
+			return s_kernels[static_cast< std::size_t >(GetSIMDLevel())];
+		}
+
+		#undef MAML_BATCH_KERNELS
+	}
+
+	//-------------------------------------------------------------------------
+	// Batch Operations
+	//-------------------------------------------------------------------------
+
+	/**
+	 Computes the sum of the given values with the kernel of the active SIMD
+	 level. The summation order (and thus the rounding) depends on that level.
+
+	 @param[in]		a
+					The values.
+	 @return		The sum of the given values.
+	 */
+	[[nodiscard]]
+	inline F32 Sum(std::span< const F32 > a) noexcept {
+		return details::GetBatchKernels().m_sum(a.data(), a.size());
+	}
+
+	/**
+	 Computes the dot product of the given values with the kernel of the
+	 active SIMD level.
+
+	 @pre			@a a and @a b have the same size.
+	 @param[in]		a
+					The first values.
+	 @param[in]		b
+					The second values.
+	 @return		The dot product of the given values.
+	 */
+	[[nodiscard]]
+	inline F32 Dot(std::span< const F32 > a, std::span< const F32 > b) noexcept {
+		return details::GetBatchKernels().m_dot(a.data(), b.data(), a.size());
+	}
+
+	/**
+	 Computes @a a * @a s + @a t for each of the given values with the kernel
+	 of the active SIMD level.
+
+	 @pre			@a result is at least as large as @a a.
+	 @param[in]		a
+					The values.
+	 @param[in]		s
+					The scale.
+	 @param[in]		t
+					The translation.
+	 @param[out]	result
+					The transformed values.
+	 */
+	inline void MulAdd(std::span< const F32 > a, F32 s, F32 t,
+					   std::span< F32 > result) noexcept {
+		details::GetBatchKernels().m_mul_add(a.data(), s, t, result.data(), a.size());
+	}
+
+	/**
+	 Converts the given values with the kernel of the active SIMD level.
+
+	 @pre			@a result is at least as large as @a a.
+	 @param[in]		a
+					The values.
+	 @param[out]	result
+					The converted values.
+	 */
+	inline void Convert(std::span< const F64 > a, std::span< F32 > result) noexcept {
+		details::GetBatchKernels().m_f64_to_f32(a.data(), result.data(), a.size());
+	}
+
+	/**
+	 Converts the given values with the kernel of the active SIMD level.
+
+	 @pre			@a result is at least as large as @a a.
+	 @param[in]		a
+					The values.
+	 @param[out]	result
+					The converted values.
+	 */
+	inline void Convert(std::span< const F32 > a, std::span< F64 > result) noexcept {
+		details::GetBatchKernels().m_f32_to_f64(a.data(), result.data(), a.size());
+	}
+}
@@ -0,0 +1,210 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#include <immintrin.h>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	//-------------------------------------------------------------------------
+	// SIMDLevel
+	//-------------------------------------------------------------------------
+
+	/**
+	 An enumeration of the SIMD instruction set levels a batch kernel can be
+	 specialized for. Each level implies all lower levels.
+	 */
+	enum class SIMDLevel : U8 {
+		None = 0u,
+		SSE2,
+		SSE4_1,
+		AVX2,
+		AVX512
+	};
+
+	namespace details {
+
+		[[nodiscard]]
+		inline const Array< U32, 4u > CPUID(U32 leaf, U32 subleaf = 0u) noexcept {
+			Array< U32, 4u > registers;
+			#ifdef _MSC_VER
+			int values[4u] = {};
+			__cpuidex(values, static_cast< int >(leaf), static_cast< int >(subleaf));
+			std::memcpy(registers.data(), values, sizeof(values));
+			#else
+			__cpuid_count(leaf, subleaf,
+						  registers[0u], registers[1u], registers[2u], registers[3u]);
+			#endif
+			return registers;
+		}
+
+		[[nodiscard]]
+		inline U64 XGETBV() noexcept {
+			#ifdef _MSC_VER
+			return _xgetbv(0u);
+			#else
+			U32 eax = 0u;
+			U32 edx = 0u;
+			__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0u));
+			return (static_cast< U64 >(edx) << 32u) | eax;
+			#endif
+		}
+
+		[[nodiscard]]
+		constexpr bool HasBit(U32 value, U32 bit) noexcept {
+			return 0u != (value & (1u << bit));
+		}
+
+		[[nodiscard]]
+		inline SIMDLevel ParseSIMDLevel(const char* name,
+										SIMDLevel fallback) noexcept {
+			if (nullptr == name) {
+				return fallback;
+			}
+
+			constexpr const char* s_names[] = {
+				"none", "sse2", "sse4.1", "avx2", "avx512"
+			};
+			for (std::size_t i = 0u; i < std::size(s_names); ++i) {
+				if (0 == std::strcmp(name, s_names[i])) {
+					return static_cast< SIMDLevel >(i);
+				}
+			}
+
+			return fallback;
+		}
+	}
+
+	/**
+	 Detects the highest SIMD level supported by both the processor and the
+	 operating system (i.e. the extended register state is saved on context
+	 switches).
+
+	 @return		The highest supported SIMD level.
+	 */
+	[[nodiscard]]
+	inline SIMDLevel DetectSIMDLevel() noexcept {
+		using details::HasBit;
+
+		const auto max_leaf = details::CPUID(0u)[0u];
+		if (max_leaf < 1u) {
+			return SIMDLevel::None;
+		}
+
+		const auto leaf1 = details::CPUID(1u);
+		if (!HasBit(leaf1[3u], 26u)) {
+			return SIMDLevel::None;
+		}
+		if (!HasBit(leaf1[2u], 19u)) {
+			return SIMDLevel::SSE2;
+		}
+
+		// AVX requires OSXSAVE and the XMM/YMM state to be enabled.
+		const bool avx = HasBit(leaf1[2u], 28u) && HasBit(leaf1[2u], 27u)
+			          && (0x6u == (details::XGETBV() & 0x6u));
+		if (!avx || max_leaf < 7u) {
+			return SIMDLevel::SSE4_1;
+		}
+
+		const auto leaf7 = details::CPUID(7u);
+		const bool avx2 = HasBit(leaf7[1u], 5u) && HasBit(leaf1[2u], 12u);
+		if (!avx2) {
+			return SIMDLevel::SSE4_1;
+		}
+
+		// AVX-512F additionally requires the opmask/ZMM state to be enabled.
+		const bool avx512 = HasBit(leaf7[1u], 16u)
+			             && (0xE6u == (details::XGETBV() & 0xE6u));
+		return avx512 ? SIMDLevel::AVX512 : SIMDLevel::AVX2;
+	}
+
+	/**
+	 Returns the SIMD level supported by this machine. The detection is
+	 performed only once.
+
+	 @return		The highest supported SIMD level.
+	 */
+	[[nodiscard]]
+	inline SIMDLevel GetSupportedSIMDLevel() noexcept {
+		static const SIMDLevel s_level = DetectSIMDLevel();
+		return s_level;
+	}
+
+	namespace details {
+
+		[[nodiscard]]
+		inline SIMDLevel InitialSIMDLevel() noexcept {
+			const SIMDLevel supported = GetSupportedSIMDLevel();
+
+			#pragma warning( push )
+			#pragma warning( disable : 4996 ) // getenv may be unsafe.
+			const char* const name = std::getenv("MAML_SIMD_LEVEL");
+			#pragma warning( pop )
+
+			const SIMDLevel requested = ParseSIMDLevel(name, supported);
+			return (requested < supported) ? requested : supported;
+		}
+
+		[[nodiscard]]
+		inline std::atomic< SIMDLevel >& ActiveSIMDLevel() noexcept {
+			static std::atomic< SIMDLevel > s_level = InitialSIMDLevel();
+			return s_level;
+		}
+	}
+
+	/**
+	 Returns the SIMD level used by the batch kernels.
+
+	 By default, this is the highest supported SIMD level, unless lowered by
+	 the MAML_SIMD_LEVEL environment variable ("none", "sse2", "sse4.1",
+	 "avx2" or "avx512") or by @c SetSIMDLevel.
+
+	 @return		The active SIMD level.
+	 */
+	[[nodiscard]]
+	inline SIMDLevel GetSIMDLevel() noexcept {
+		return details::ActiveSIMDLevel().load(std::memory_order_relaxed);
+	}
+
+	/**
+	 Sets the SIMD level used by the batch kernels. Levels that are not
+	 supported by this machine are clamped to the highest supported level.
+
+	 @param[in]		level
+					The requested SIMD level.
+	 @return		The SIMD level that will be used.
+	 */
+	inline SIMDLevel SetSIMDLevel(SIMDLevel level) noexcept {
+		const SIMDLevel supported = GetSupportedSIMDLevel();
+		const SIMDLevel active = (level < supported) ? level : supported;
+		details::ActiveSIMDLevel().store(active, std::memory_order_relaxed);
+		return active;
+	}
+}
@@ -0,0 +1,785 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "simd\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <immintrin.h>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	//-------------------------------------------------------------------------
+	// SSE2 Helpers
+	//-------------------------------------------------------------------------
+
+	// The integer packets only require SSE2: the SSE4.1 and SSSE3
+	// instructions (extract, mullo, min/max, abs, packus) are emulated.
+
+	namespace details {
+
+		template< int I >
+		[[nodiscard]]
+		inline S32 __vectorcall Extract32(__m128i v) noexcept {
+			return _mm_cvtsi128_si32(_mm_shuffle_epi32(v, _MM_SHUFFLE(I, I, I, I)));
+		}
+
+		[[nodiscard]]
+		inline __m128i __vectorcall MulLo32(__m128i a, __m128i b) noexcept {
+			// The low 32 bits of the product do not depend on the signedness.
+			const __m128i even = _mm_mul_epu32(a, b);
+			const __m128i odd  = _mm_mul_epu32(_mm_srli_si128(a, 4),
+											   _mm_srli_si128(b, 4));
+			return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+									  _mm_shuffle_epi32(odd,  _MM_SHUFFLE(0, 0, 2, 0)));
+		}
+
+		[[nodiscard]]
+		inline __m128i __vectorcall Select32(__m128i mask,
+											 __m128i a, __m128i b) noexcept {
+			return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// S32x4S
+	//-------------------------------------------------------------------------
+
+	struct alignas(16) S32x4S {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		explicit S32x4S(S32 xyzw = 0) noexcept
+			: S32x4S(_mm_set1_epi32(xyzw)) {}
+		S32x4S(S32 x, S32 y, S32 z, S32 w) noexcept
+			: S32x4S(_mm_set_epi32(w, z, y, x)) {}
+		S32x4S(const S32x4& v) noexcept
+			: S32x4S(_mm_loadu_si128(reinterpret_cast< const __m128i* >(v.data()))) {}
+		explicit S32x4S(const F32x4S& v) noexcept
+			: S32x4S(_mm_cvttps_epi32(v.m_v)) {}
+		S32x4S(__m128i v) noexcept
+			: m_v(v) {}
+
+		S32x4S(const S32x4S& v) noexcept = default;
+		S32x4S(S32x4S&& v) noexcept = default;
+		~S32x4S() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		S32x4S& operator=(const S32x4S& v) noexcept = default;
+		S32x4S& operator=(S32x4S&& v) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		explicit operator S32x4() const noexcept {
+			S32x4 v;
+			_mm_storeu_si128(reinterpret_cast< __m128i* >(v.data()), m_v);
+			return v;
+		}
+
+		[[nodiscard]]
+		explicit operator F32x4S() const noexcept {
+			return _mm_cvtepi32_ps(m_v);
+		}
+
+		[[nodiscard]]
+		S32 __vectorcall X() const noexcept {
+			return _mm_cvtsi128_si32(m_v);
+		}
+		[[nodiscard]]
+		S32 __vectorcall Y() const noexcept {
+			return details::Extract32< 1 >(m_v);
+		}
+		[[nodiscard]]
+		S32 __vectorcall Z() const noexcept {
+			return details::Extract32< 2 >(m_v);
+		}
+		[[nodiscard]]
+		S32 __vectorcall W() const noexcept {
+			return details::Extract32< 3 >(m_v);
+		}
+
+		[[nodiscard]]
+		const S32x4S __vectorcall operator+() const noexcept {
+			return m_v;
+		}
+		[[nodiscard]]
+		const S32x4S __vectorcall operator-() const noexcept {
+			return _mm_sub_epi32(_mm_setzero_si128(), m_v);
+		}
+		[[nodiscard]]
+		const S32x4S __vectorcall operator~() const noexcept {
+			return _mm_xor_si128(m_v, _mm_set1_epi32(-1));
+		}
+
+		[[nodiscard]]
+		const S32x4S __vectorcall operator+(const S32x4S& v) const noexcept {
+			return _mm_add_epi32(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const S32x4S __vectorcall operator-(const S32x4S& v) const noexcept {
+			return _mm_sub_epi32(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const S32x4S __vectorcall operator*(const S32x4S& v) const noexcept {
+			return details::MulLo32(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const S32x4S __vectorcall operator&(const S32x4S& v) const noexcept {
+			return _mm_and_si128(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const S32x4S __vectorcall operator|(const S32x4S& v) const noexcept {
+			return _mm_or_si128(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const S32x4S __vectorcall operator^(const S32x4S& v) const noexcept {
+			return _mm_xor_si128(m_v, v.m_v);
+		}
+
+		[[nodiscard]]
+		const S32x4S __vectorcall operator+(S32 a) const noexcept {
+			return _mm_add_epi32(m_v, _mm_set1_epi32(a));
+		}
+		[[nodiscard]]
+		const S32x4S __vectorcall operator-(S32 a) const noexcept {
+			return _mm_sub_epi32(m_v, _mm_set1_epi32(a));
+		}
+		[[nodiscard]]
+		const S32x4S __vectorcall operator*(S32 a) const noexcept {
+			return details::MulLo32(m_v, _mm_set1_epi32(a));
+		}
+		[[nodiscard]]
+		const S32x4S __vectorcall operator<<(int count) const noexcept {
+			return _mm_sll_epi32(m_v, _mm_cvtsi32_si128(count));
+		}
+		[[nodiscard]]
+		const S32x4S __vectorcall operator>>(int count) const noexcept {
+			// Arithmetic shift.
+			return _mm_sra_epi32(m_v, _mm_cvtsi32_si128(count));
+		}
+
+		S32x4S& __vectorcall operator+=(const S32x4S& v) noexcept {
+			m_v = _mm_add_epi32(m_v, v.m_v);
+			return *this;
+		}
+		S32x4S& __vectorcall operator-=(const S32x4S& v) noexcept {
+			m_v = _mm_sub_epi32(m_v, v.m_v);
+			return *this;
+		}
+		S32x4S& __vectorcall operator*=(const S32x4S& v) noexcept {
+			m_v = details::MulLo32(m_v, v.m_v);
+			return *this;
+		}
+		S32x4S& __vectorcall operator&=(const S32x4S& v) noexcept {
+			m_v = _mm_and_si128(m_v, v.m_v);
+			return *this;
+		}
+		S32x4S& __vectorcall operator|=(const S32x4S& v) noexcept {
+			m_v = _mm_or_si128(m_v, v.m_v);
+			return *this;
+		}
+		S32x4S& __vectorcall operator^=(const S32x4S& v) noexcept {
+			m_v = _mm_xor_si128(m_v, v.m_v);
+			return *this;
+		}
+
+		S32x4S& __vectorcall operator+=(S32 a) noexcept {
+			m_v = _mm_add_epi32(m_v, _mm_set1_epi32(a));
+			return *this;
+		}
+		S32x4S& __vectorcall operator-=(S32 a) noexcept {
+			m_v = _mm_sub_epi32(m_v, _mm_set1_epi32(a));
+			return *this;
+		}
+		S32x4S& __vectorcall operator*=(S32 a) noexcept {
+			m_v = details::MulLo32(m_v, _mm_set1_epi32(a));
+			return *this;
+		}
+		S32x4S& __vectorcall operator<<=(int count) noexcept {
+			m_v = _mm_sll_epi32(m_v, _mm_cvtsi32_si128(count));
+			return *this;
+		}
+		S32x4S& __vectorcall operator>>=(int count) noexcept {
+			m_v = _mm_sra_epi32(m_v, _mm_cvtsi32_si128(count));
+			return *this;
+		}
+
+		[[nodiscard]]
+		bool __vectorcall operator==(const S32x4S& v) const {
+			const __m128i results = _mm_cmpeq_epi32(m_v, v.m_v);
+			return (0xFFFF == _mm_movemask_epi8(results));
+		}
+		[[nodiscard]]
+		bool __vectorcall operator!=(const S32x4S& v) const {
+			return !(*this == v);
+		}
+
+		// Component-wise comparisons: each component is set to all ones if
+		// the comparison holds, and to all zeros otherwise.
+
+		[[nodiscard]]
+		const S32x4S __vectorcall operator<(const S32x4S& v) const noexcept {
+			return _mm_cmplt_epi32(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const S32x4S __vectorcall operator>(const S32x4S& v) const noexcept {
+			return _mm_cmpgt_epi32(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const S32x4S __vectorcall operator<=(const S32x4S& v) const noexcept {
+			return ~(*this > v);
+		}
+		[[nodiscard]]
+		const S32x4S __vectorcall operator>=(const S32x4S& v) const noexcept {
+			return ~(*this < v);
+		}
+
+		__m128i m_v;
+	};
+
+	[[nodiscard]]
+	inline const S32x4S __vectorcall operator+(S32 a, const S32x4S& v) noexcept {
+		return _mm_add_epi32(_mm_set1_epi32(a), v.m_v);
+	}
+	[[nodiscard]]
+	inline const S32x4S __vectorcall operator-(S32 a, const S32x4S& v) noexcept {
+		return _mm_sub_epi32(_mm_set1_epi32(a), v.m_v);
+	}
+	[[nodiscard]]
+	inline const S32x4S __vectorcall operator*(S32 a, const S32x4S& v) noexcept {
+		return details::MulLo32(_mm_set1_epi32(a), v.m_v);
+	}
+
+	[[nodiscard]]
+	inline const S32x4S __vectorcall Min(const S32x4S& a, const S32x4S& b) noexcept {
+		return details::Select32(_mm_cmpgt_epi32(a.m_v, b.m_v), b.m_v, a.m_v);
+	}
+	[[nodiscard]]
+	inline const S32x4S __vectorcall Max(const S32x4S& a, const S32x4S& b) noexcept {
+		return details::Select32(_mm_cmpgt_epi32(a.m_v, b.m_v), a.m_v, b.m_v);
+	}
+	[[nodiscard]]
+	inline const S32x4S __vectorcall Abs(const S32x4S& v) noexcept {
+		const __m128i sign = _mm_srai_epi32(v.m_v, 31);
+		return _mm_sub_epi32(_mm_xor_si128(v.m_v, sign), sign);
+	}
+
+	//-------------------------------------------------------------------------
+	// U32x4S
+	//-------------------------------------------------------------------------
+
+	namespace details {
+
+		[[nodiscard]]
+		inline __m128i __vectorcall ConvertF32x4ToU32x4(__m128 v) noexcept {
+			// Values in [2^31, 2^32) do not fit _mm_cvttps_epi32: convert
+			// v - 2^31 and restore the most significant bit afterwards.
+			const __m128  two31   = _mm_set_ps1(2147483648.0f);
+			const __m128  large   = _mm_cmpge_ps(v, two31);
+			const __m128  reduced = _mm_sub_ps(v, _mm_and_ps(large, two31));
+			const __m128i msb     = _mm_slli_epi32(_mm_castps_si128(large), 31);
+			return _mm_xor_si128(_mm_cvttps_epi32(reduced), msb);
+		}
+
+		[[nodiscard]]
+		inline __m128 __vectorcall ConvertU32x4ToF32x4(__m128i v) noexcept {
+			// Both 16-bit halves are converted exactly; only the final
+			// addition rounds.
+			const __m128i lo = _mm_and_si128(v, _mm_set1_epi32(0xFFFF));
+			const __m128i hi = _mm_srli_epi32(v, 16);
+			return _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(hi), _mm_set_ps1(65536.0f)),
+							  _mm_cvtepi32_ps(lo));
+		}
+
+		[[nodiscard]]
+		inline __m128i __vectorcall FlipSignBits32(__m128i v) noexcept {
+			return _mm_xor_si128(v, _mm_set1_epi32(S32(0x80000000)));
+		}
+	}
+
+	struct alignas(16) U32x4S {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		explicit U32x4S(U32 xyzw = 0u) noexcept
+			: U32x4S(_mm_set1_epi32(static_cast< S32 >(xyzw))) {}
+		U32x4S(U32 x, U32 y, U32 z, U32 w) noexcept
+			: U32x4S(_mm_set_epi32(static_cast< S32 >(w), static_cast< S32 >(z),
+								   static_cast< S32 >(y), static_cast< S32 >(x))) {}
+		U32x4S(const U32x4& v) noexcept
+			: U32x4S(_mm_loadu_si128(reinterpret_cast< const __m128i* >(v.data()))) {}
+		explicit U32x4S(const F32x4S& v) noexcept
+			: U32x4S(details::ConvertF32x4ToU32x4(v.m_v)) {}
+		U32x4S(__m128i v) noexcept
+			: m_v(v) {}
+
+		U32x4S(const U32x4S& v) noexcept = default;
+		U32x4S(U32x4S&& v) noexcept = default;
+		~U32x4S() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		U32x4S& operator=(const U32x4S& v) noexcept = default;
+		U32x4S& operator=(U32x4S&& v) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		explicit operator U32x4() const noexcept {
+			U32x4 v;
+			_mm_storeu_si128(reinterpret_cast< __m128i* >(v.data()), m_v);
+			return v;
+		}
+
+		[[nodiscard]]
+		explicit operator F32x4S() const noexcept {
+			return details::ConvertU32x4ToF32x4(m_v);
+		}
+
+		[[nodiscard]]
+		U32 __vectorcall X() const noexcept {
+			return static_cast< U32 >(_mm_cvtsi128_si32(m_v));
+		}
+		[[nodiscard]]
+		U32 __vectorcall Y() const noexcept {
+			return static_cast< U32 >(details::Extract32< 1 >(m_v));
+		}
+		[[nodiscard]]
+		U32 __vectorcall Z() const noexcept {
+			return static_cast< U32 >(details::Extract32< 2 >(m_v));
+		}
+		[[nodiscard]]
+		U32 __vectorcall W() const noexcept {
+			return static_cast< U32 >(details::Extract32< 3 >(m_v));
+		}
+
+		[[nodiscard]]
+		const U32x4S __vectorcall operator+() const noexcept {
+			return m_v;
+		}
+		[[nodiscard]]
+		const U32x4S __vectorcall operator~() const noexcept {
+			return _mm_xor_si128(m_v, _mm_set1_epi32(-1));
+		}
+
+		[[nodiscard]]
+		const U32x4S __vectorcall operator+(const U32x4S& v) const noexcept {
+			return _mm_add_epi32(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const U32x4S __vectorcall operator-(const U32x4S& v) const noexcept {
+			return _mm_sub_epi32(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const U32x4S __vectorcall operator*(const U32x4S& v) const noexcept {
+			return details::MulLo32(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const U32x4S __vectorcall operator&(const U32x4S& v) const noexcept {
+			return _mm_and_si128(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const U32x4S __vectorcall operator|(const U32x4S& v) const noexcept {
+			return _mm_or_si128(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const U32x4S __vectorcall operator^(const U32x4S& v) const noexcept {
+			return _mm_xor_si128(m_v, v.m_v);
+		}
+
+		[[nodiscard]]
+		const U32x4S __vectorcall operator+(U32 a) const noexcept {
+			return *this + U32x4S(a);
+		}
+		[[nodiscard]]
+		const U32x4S __vectorcall operator-(U32 a) const noexcept {
+			return *this - U32x4S(a);
+		}
+		[[nodiscard]]
+		const U32x4S __vectorcall operator*(U32 a) const noexcept {
+			return *this * U32x4S(a);
+		}
+		[[nodiscard]]
+		const U32x4S __vectorcall operator<<(int count) const noexcept {
+			return _mm_sll_epi32(m_v, _mm_cvtsi32_si128(count));
+		}
+		[[nodiscard]]
+		const U32x4S __vectorcall operator>>(int count) const noexcept {
+			// Logical shift.
+			return _mm_srl_epi32(m_v, _mm_cvtsi32_si128(count));
+		}
+
+		U32x4S& __vectorcall operator+=(const U32x4S& v) noexcept {
+			m_v = _mm_add_epi32(m_v, v.m_v);
+			return *this;
+		}
+		U32x4S& __vectorcall operator-=(const U32x4S& v) noexcept {
+			m_v = _mm_sub_epi32(m_v, v.m_v);
+			return *this;
+		}
+		U32x4S& __vectorcall operator*=(const U32x4S& v) noexcept {
+			m_v = details::MulLo32(m_v, v.m_v);
+			return *this;
+		}
+		U32x4S& __vectorcall operator&=(const U32x4S& v) noexcept {
+			m_v = _mm_and_si128(m_v, v.m_v);
+			return *this;
+		}
+		U32x4S& __vectorcall operator|=(const U32x4S& v) noexcept {
+			m_v = _mm_or_si128(m_v, v.m_v);
+			return *this;
+		}
+		U32x4S& __vectorcall operator^=(const U32x4S& v) noexcept {
+			m_v = _mm_xor_si128(m_v, v.m_v);
+			return *this;
+		}
+
+		U32x4S& __vectorcall operator+=(U32 a) noexcept {
+			return *this += U32x4S(a);
+		}
+		U32x4S& __vectorcall operator-=(U32 a) noexcept {
+			return *this -= U32x4S(a);
+		}
+		U32x4S& __vectorcall operator*=(U32 a) noexcept {
+			return *this *= U32x4S(a);
+		}
+		U32x4S& __vectorcall operator<<=(int count) noexcept {
+			m_v = _mm_sll_epi32(m_v, _mm_cvtsi32_si128(count));
+			return *this;
+		}
+		U32x4S& __vectorcall operator>>=(int count) noexcept {
+			m_v = _mm_srl_epi32(m_v, _mm_cvtsi32_si128(count));
+			return *this;
+		}
+
+		[[nodiscard]]
+		bool __vectorcall operator==(const U32x4S& v) const {
+			const __m128i results = _mm_cmpeq_epi32(m_v, v.m_v);
+			return (0xFFFF == _mm_movemask_epi8(results));
+		}
+		[[nodiscard]]
+		bool __vectorcall operator!=(const U32x4S& v) const {
+			return !(*this == v);
+		}
+
+		// Component-wise comparisons: each component is set to all ones if
+		// the comparison holds, and to all zeros otherwise.
+
+		[[nodiscard]]
+		const U32x4S __vectorcall operator<(const U32x4S& v) const noexcept {
+			return _mm_cmplt_epi32(details::FlipSignBits32(m_v),
+								   details::FlipSignBits32(v.m_v));
+		}
+		[[nodiscard]]
+		const U32x4S __vectorcall operator>(const U32x4S& v) const noexcept {
+			return _mm_cmpgt_epi32(details::FlipSignBits32(m_v),
+								   details::FlipSignBits32(v.m_v));
+		}
+		[[nodiscard]]
+		const U32x4S __vectorcall operator<=(const U32x4S& v) const noexcept {
+			return ~(*this > v);
+		}
+		[[nodiscard]]
+		const U32x4S __vectorcall operator>=(const U32x4S& v) const noexcept {
+			return ~(*this < v);
+		}
+
+		__m128i m_v;
+	};
+
+	[[nodiscard]]
+	inline const U32x4S __vectorcall operator+(U32 a, const U32x4S& v) noexcept {
+		return U32x4S(a) + v;
+	}
+	[[nodiscard]]
+	inline const U32x4S __vectorcall operator-(U32 a, const U32x4S& v) noexcept {
+		return U32x4S(a) - v;
+	}
+	[[nodiscard]]
+	inline const U32x4S __vectorcall operator*(U32 a, const U32x4S& v) noexcept {
+		return U32x4S(a) * v;
+	}
+
+	[[nodiscard]]
+	inline const U32x4S __vectorcall Min(const U32x4S& a, const U32x4S& b) noexcept {
+		const __m128i greater = _mm_cmpgt_epi32(details::FlipSignBits32(a.m_v),
+												details::FlipSignBits32(b.m_v));
+		return details::Select32(greater, b.m_v, a.m_v);
+	}
+	[[nodiscard]]
+	inline const U32x4S __vectorcall Max(const U32x4S& a, const U32x4S& b) noexcept {
+		const __m128i greater = _mm_cmpgt_epi32(details::FlipSignBits32(a.m_v),
+												details::FlipSignBits32(b.m_v));
+		return details::Select32(greater, a.m_v, b.m_v);
+	}
+
+	//-------------------------------------------------------------------------
+	// U16x8S
+	//-------------------------------------------------------------------------
+
+	namespace details {
+
+		[[nodiscard]]
+		inline __m128i __vectorcall FlipSignBits16(__m128i v) noexcept {
+			return _mm_xor_si128(v, _mm_set1_epi16(S16(0x8000)));
+		}
+
+		/**
+		 Packs the given 32-bit components in [0, 65535] to 16 bits.
+		 */
+		[[nodiscard]]
+		inline __m128i __vectorcall PackSaturated16(__m128i lo, __m128i hi) noexcept {
+			// Bias to the signed 16-bit range, which _mm_packs_epi32 packs
+			// exactly, and flip the sign bits back.
+			const __m128i bias = _mm_set1_epi32(0x8000);
+			return FlipSignBits16(_mm_packs_epi32(_mm_sub_epi32(lo, bias),
+												  _mm_sub_epi32(hi, bias)));
+		}
+	}
+
+	struct alignas(16) U16x8S {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		explicit U16x8S(U16 v = 0u) noexcept
+			: U16x8S(_mm_set1_epi16(static_cast< S16 >(v))) {}
+		U16x8S(U16 v0, U16 v1, U16 v2, U16 v3,
+			   U16 v4, U16 v5, U16 v6, U16 v7) noexcept
+			: U16x8S(_mm_set_epi16(static_cast< S16 >(v7), static_cast< S16 >(v6),
+								   static_cast< S16 >(v5), static_cast< S16 >(v4),
+								   static_cast< S16 >(v3), static_cast< S16 >(v2),
+								   static_cast< S16 >(v1), static_cast< S16 >(v0))) {}
+		U16x8S(const U16x8& v) noexcept
+			: U16x8S(_mm_loadu_si128(reinterpret_cast< const __m128i* >(v.data()))) {}
+		/**
+		 Packs the given vectors, saturating components larger than 65535.
+		 */
+		U16x8S(const U32x4S& lo, const U32x4S& hi) noexcept
+			: U16x8S(details::PackSaturated16(Min(lo, U32x4S(0xFFFFu)).m_v,
+											  Min(hi, U32x4S(0xFFFFu)).m_v)) {}
+		U16x8S(__m128i v) noexcept
+			: m_v(v) {}
+
+		U16x8S(const U16x8S& v) noexcept = default;
+		U16x8S(U16x8S&& v) noexcept = default;
+		~U16x8S() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		U16x8S& operator=(const U16x8S& v) noexcept = default;
+		U16x8S& operator=(U16x8S&& v) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		explicit operator U16x8() const noexcept {
+			U16x8 v;
+			_mm_storeu_si128(reinterpret_cast< __m128i* >(v.data()), m_v);
+			return v;
+		}
+
+		[[nodiscard]]
+		const U32x4S __vectorcall Lo() const noexcept {
+			return _mm_unpacklo_epi16(m_v, _mm_setzero_si128());
+		}
+		[[nodiscard]]
+		const U32x4S __vectorcall Hi() const noexcept {
+			return _mm_unpackhi_epi16(m_v, _mm_setzero_si128());
+		}
+
+		[[nodiscard]]
+		const U16x8S __vectorcall operator+() const noexcept {
+			return m_v;
+		}
+		[[nodiscard]]
+		const U16x8S __vectorcall operator~() const noexcept {
+			return _mm_xor_si128(m_v, _mm_set1_epi16(-1));
+		}
+
+		[[nodiscard]]
+		const U16x8S __vectorcall operator+(const U16x8S& v) const noexcept {
+			return _mm_add_epi16(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const U16x8S __vectorcall operator-(const U16x8S& v) const noexcept {
+			return _mm_sub_epi16(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const U16x8S __vectorcall operator*(const U16x8S& v) const noexcept {
+			return _mm_mullo_epi16(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const U16x8S __vectorcall operator&(const U16x8S& v) const noexcept {
+			return _mm_and_si128(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const U16x8S __vectorcall operator|(const U16x8S& v) const noexcept {
+			return _mm_or_si128(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const U16x8S __vectorcall operator^(const U16x8S& v) const noexcept {
+			return _mm_xor_si128(m_v, v.m_v);
+		}
+
+		[[nodiscard]]
+		const U16x8S __vectorcall operator+(U16 a) const noexcept {
+			return *this + U16x8S(a);
+		}
+		[[nodiscard]]
+		const U16x8S __vectorcall operator-(U16 a) const noexcept {
+			return *this - U16x8S(a);
+		}
+		[[nodiscard]]
+		const U16x8S __vectorcall operator*(U16 a) const noexcept {
+			return *this * U16x8S(a);
+		}
+		[[nodiscard]]
+		const U16x8S __vectorcall operator<<(int count) const noexcept {
+			return _mm_sll_epi16(m_v, _mm_cvtsi32_si128(count));
+		}
+		[[nodiscard]]
+		const U16x8S __vectorcall operator>>(int count) const noexcept {
+			// Logical shift.
+			return _mm_srl_epi16(m_v, _mm_cvtsi32_si128(count));
+		}
+
+		U16x8S& __vectorcall operator+=(const U16x8S& v) noexcept {
+			m_v = _mm_add_epi16(m_v, v.m_v);
+			return *this;
+		}
+		U16x8S& __vectorcall operator-=(const U16x8S& v) noexcept {
+			m_v = _mm_sub_epi16(m_v, v.m_v);
+			return *this;
+		}
+		U16x8S& __vectorcall operator*=(const U16x8S& v) noexcept {
+			m_v = _mm_mullo_epi16(m_v, v.m_v);
+			return *this;
+		}
+		U16x8S& __vectorcall operator&=(const U16x8S& v) noexcept {
+			m_v = _mm_and_si128(m_v, v.m_v);
+			return *this;
+		}
+		U16x8S& __vectorcall operator|=(const U16x8S& v) noexcept {
+			m_v = _mm_or_si128(m_v, v.m_v);
+			return *this;
+		}
+		U16x8S& __vectorcall operator^=(const U16x8S& v) noexcept {
+			m_v = _mm_xor_si128(m_v, v.m_v);
+			return *this;
+		}
+
+		U16x8S& __vectorcall operator+=(U16 a) noexcept {
+			return *this += U16x8S(a);
+		}
+		U16x8S& __vectorcall operator-=(U16 a) noexcept {
+			return *this -= U16x8S(a);
+		}
+		U16x8S& __vectorcall operator*=(U16 a) noexcept {
+			return *this *= U16x8S(a);
+		}
+		U16x8S& __vectorcall operator<<=(int count) noexcept {
+			m_v = _mm_sll_epi16(m_v, _mm_cvtsi32_si128(count));
+			return *this;
+		}
+		U16x8S& __vectorcall operator>>=(int count) noexcept {
+			m_v = _mm_srl_epi16(m_v, _mm_cvtsi32_si128(count));
+			return *this;
+		}
+
+		[[nodiscard]]
+		bool __vectorcall operator==(const U16x8S& v) const {
+			const __m128i results = _mm_cmpeq_epi16(m_v, v.m_v);
+			return (0xFFFF == _mm_movemask_epi8(results));
+		}
+		[[nodiscard]]
+		bool __vectorcall operator!=(const U16x8S& v) const {
+			return !(*this == v);
+		}
+
+		// Component-wise comparisons: each component is set to all ones if
+		// the comparison holds, and to all zeros otherwise.
+
+		[[nodiscard]]
+		const U16x8S __vectorcall operator<(const U16x8S& v) const noexcept {
+			return _mm_cmplt_epi16(details::FlipSignBits16(m_v),
+								   details::FlipSignBits16(v.m_v));
+		}
+		[[nodiscard]]
+		const U16x8S __vectorcall operator>(const U16x8S& v) const noexcept {
+			return _mm_cmpgt_epi16(details::FlipSignBits16(m_v),
+								   details::FlipSignBits16(v.m_v));
+		}
+		[[nodiscard]]
+		const U16x8S __vectorcall operator<=(const U16x8S& v) const noexcept {
+			return ~(*this > v);
+		}
+		[[nodiscard]]
+		const U16x8S __vectorcall operator>=(const U16x8S& v) const noexcept {
+			return ~(*this < v);
+		}
+
+		__m128i m_v;
+	};
+
+	[[nodiscard]]
+	inline const U16x8S __vectorcall operator+(U16 a, const U16x8S& v) noexcept {
+		return U16x8S(a) + v;
+	}
+	[[nodiscard]]
+	inline const U16x8S __vectorcall operator-(U16 a, const U16x8S& v) noexcept {
+		return U16x8S(a) - v;
+	}
+	[[nodiscard]]
+	inline const U16x8S __vectorcall operator*(U16 a, const U16x8S& v) noexcept {
+		return U16x8S(a) * v;
+	}
+
+	[[nodiscard]]
+	inline const U16x8S __vectorcall Min(const U16x8S& a, const U16x8S& b) noexcept {
+		return _mm_sub_epi16(a.m_v, _mm_subs_epu16(a.m_v, b.m_v));
+	}
+	[[nodiscard]]
+	inline const U16x8S __vectorcall Max(const U16x8S& a, const U16x8S& b) noexcept {
+		return _mm_add_epi16(b.m_v, _mm_subs_epu16(a.m_v, b.m_v));
+	}
+}
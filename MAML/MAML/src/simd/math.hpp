@@ -0,0 +1,541 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "simd\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <immintrin.h>
+#include <limits>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	namespace details {
+
+		//---------------------------------------------------------------------
+		// Rounding and Bit Manipulation
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns @a v unless its magnitude is smaller than 2^23, in which case
+		 @a v is representable as a 32-bit integer and the given rounded
+		 value is returned with the sign of @a v (SSE2 rounding helper).
+		 */
+		[[nodiscard]]
+		inline const F32x4S __vectorcall SelectRounded(const F32x4S& v, __m128 rounded) noexcept {
+			// Values of magnitude 2^23 or larger (and NaN) are integral already.
+			const __m128 sign  = _mm_and_ps(v.m_v, _mm_set_ps1(-0.0f));
+			const __m128 small = _mm_cmplt_ps(_mm_andnot_ps(_mm_set_ps1(-0.0f), v.m_v),
+											  _mm_set_ps1(8388608.0f));
+			// A rounded negative value is negative or zero, so or-ing the sign
+			// only turns +0 into -0.
+			const __m128 r = _mm_or_ps(rounded, sign);
+			return _mm_or_ps(_mm_and_ps(small, r), _mm_andnot_ps(small, v.m_v));
+		}
+
+		[[nodiscard]]
+		inline const F32x4S __vectorcall Floor(const F32x4S& v) noexcept {
+			#if defined(__SSE4_1__) || defined(__AVX__)
+			return _mm_floor_ps(v.m_v);
+			#else
+			// Truncate and subtract one where truncation rounded up.
+			const __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(v.m_v));
+			const __m128 c = _mm_and_ps(_mm_cmpgt_ps(t, v.m_v), _mm_set_ps1(1.0f));
+			return SelectRounded(v, _mm_sub_ps(t, c));
+			#endif
+		}
+		#ifdef MAML_HAS_AVX2_VECTORS
+		[[nodiscard]]
+		inline const F32x8S __vectorcall Floor(const F32x8S& v) noexcept {
+			return _mm256_floor_ps(v.m_v);
+		}
+		#endif
+
+		[[nodiscard]]
+		inline const F32x4S __vectorcall Round(const F32x4S& v) noexcept {
+			#if defined(__SSE4_1__) || defined(__AVX__)
+			return _mm_round_ps(v.m_v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+			#else
+			// _mm_cvtps_epi32 rounds to nearest even (default MXCSR mode).
+			return SelectRounded(v, _mm_cvtepi32_ps(_mm_cvtps_epi32(v.m_v)));
+			#endif
+		}
+		#ifdef MAML_HAS_AVX2_VECTORS
+		[[nodiscard]]
+		inline const F32x8S __vectorcall Round(const F32x8S& v) noexcept {
+			return _mm256_round_ps(v.m_v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		}
+		#endif
+
+		[[nodiscard]]
+		inline const F32x4S __vectorcall SignBit(const F32x4S& v) noexcept {
+			return _mm_and_ps(v.m_v, _mm_set_ps1(-0.0f));
+		}
+		#ifdef MAML_HAS_AVX2_VECTORS
+		[[nodiscard]]
+		inline const F32x8S __vectorcall SignBit(const F32x8S& v) noexcept {
+			return _mm256_and_ps(v.m_v, _mm256_set1_ps(-0.0f));
+		}
+		#endif
+
+		[[nodiscard]]
+		inline const F32x4S __vectorcall XorSign(const F32x4S& v, const F32x4S& sign) noexcept {
+			return _mm_xor_ps(v.m_v, sign.m_v);
+		}
+		#ifdef MAML_HAS_AVX2_VECTORS
+		[[nodiscard]]
+		inline const F32x8S __vectorcall XorSign(const F32x8S& v, const F32x8S& sign) noexcept {
+			return _mm256_xor_ps(v.m_v, sign.m_v);
+		}
+		#endif
+
+		/**
+		 Computes 2^n for integral n in [-126, 127].
+		 */
+		[[nodiscard]]
+		inline const F32x4S __vectorcall Pow2(const F32x4S& n) noexcept {
+			const __m128i e = _mm_add_epi32(_mm_cvtps_epi32(n.m_v), _mm_set1_epi32(127));
+			return _mm_castsi128_ps(_mm_slli_epi32(e, 23));
+		}
+		#ifdef MAML_HAS_AVX2_VECTORS
+		[[nodiscard]]
+		inline const F32x8S __vectorcall Pow2(const F32x8S& n) noexcept {
+			const __m256i e = _mm256_add_epi32(_mm256_cvtps_epi32(n.m_v), _mm256_set1_epi32(127));
+			return _mm256_castsi256_ps(_mm256_slli_epi32(e, 23));
+		}
+		#endif
+
+		/**
+		 Decomposes normal v into a mantissa in [0.5, 1) and an exponent.
+		 */
+		[[nodiscard]]
+		inline const std::pair< F32x4S, F32x4S > __vectorcall Frexp(const F32x4S& v) noexcept {
+			const __m128i bits = _mm_castps_si128(v.m_v);
+			const __m128i e    = _mm_srli_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x7F800000)), 23);
+			const __m128i m    = _mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x807FFFFF)),
+											  _mm_set1_epi32(0x3F000000));
+			return {
+				F32x4S(_mm_castsi128_ps(m)),
+				F32x4S(_mm_cvtepi32_ps(_mm_sub_epi32(e, _mm_set1_epi32(126))))
+			};
+		}
+		#ifdef MAML_HAS_AVX2_VECTORS
+		[[nodiscard]]
+		inline const std::pair< F32x8S, F32x8S > __vectorcall Frexp(const F32x8S& v) noexcept {
+			const __m256i bits = _mm256_castps_si256(v.m_v);
+			const __m256i e    = _mm256_srli_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x7F800000)), 23);
+			const __m256i m    = _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x807FFFFF)),
+												 _mm256_set1_epi32(0x3F000000));
+			return {
+				F32x8S(_mm256_castsi256_ps(m)),
+				F32x8S(_mm256_cvtepi32_ps(_mm256_sub_epi32(e, _mm256_set1_epi32(126))))
+			};
+		}
+		#endif
+
+		//---------------------------------------------------------------------
+		// Kernels
+		//---------------------------------------------------------------------
+
+		template< typename VectorT >
+		[[nodiscard]]
+		inline const VectorT __vectorcall Exp(const VectorT& x) noexcept {
+			constexpr F32 lo = -103.972084f; // ln(2^-150)
+			constexpr F32 hi =   88.7228394f; // ln(FLT_MAX)
+
+			const VectorT xc = Min(Max(x, VectorT(lo)), VectorT(hi));
+
+			// x = n * ln(2) + r, |r| <= ln(2) / 2 (Cody-Waite).
+			const VectorT n = Round(xc * 1.44269504088896341f);
+			VectorT r = FMA(n, VectorT(-0.693359375f), xc);
+			r = FMA(n, VectorT(2.12194440e-4f), r);
+
+			// exp(r) = 1 + r + r^2 * P(r)
+			VectorT p(1.9875691500e-4f);
+			p = FMA(p, r, VectorT(1.3981999507e-3f));
+			p = FMA(p, r, VectorT(8.3334519073e-3f));
+			p = FMA(p, r, VectorT(4.1665795894e-2f));
+			p = FMA(p, r, VectorT(1.6666665459e-1f));
+			p = FMA(p, r, VectorT(5.0000001201e-1f));
+			p = FMA(p, r * r, r) + 1.0f;
+
+			// 2^n is applied in two steps to reach the subnormal and the
+			// largest normal results.
+			const VectorT n1 = Floor(n * 0.5f);
+			const VectorT n2 = n - n1;
+			VectorT result = p * Pow2(n1) * Pow2(n2);
+
+			constexpr F32 inf = std::numeric_limits< F32 >::infinity();
+			result = Select(x > VectorT(hi), VectorT(inf), result);
+			result = Select(x < VectorT(lo), VectorT(0.0f), result);
+			return Select(x != x, x, result);
+		}
+
+		template< typename VectorT >
+		[[nodiscard]]
+		inline const VectorT __vectorcall Log(const VectorT& x) noexcept {
+			// Scale subnormals into the normal range.
+			const auto subnormal = x < VectorT(std::numeric_limits< F32 >::min());
+			const VectorT xs = Select(subnormal, x * 8388608.0f, x);
+
+			auto [m, e] = Frexp(xs);
+			e -= Select(subnormal, VectorT(23.0f), VectorT(0.0f));
+
+			// m in [sqrt(2)/2, sqrt(2)) - 1
+			const auto small = m < VectorT(0.707106781186547524f);
+			e -= Select(small, VectorT(1.0f), VectorT(0.0f));
+			m += Select(small, m, VectorT(0.0f)) - 1.0f;
+
+			const VectorT z = m * m;
+			VectorT p(7.0376836292e-2f);
+			p = FMA(p, m, VectorT(-1.1514610310e-1f));
+			p = FMA(p, m, VectorT( 1.1676998740e-1f));
+			p = FMA(p, m, VectorT(-1.2420140846e-1f));
+			p = FMA(p, m, VectorT( 1.4249322787e-1f));
+			p = FMA(p, m, VectorT(-1.6668057665e-1f));
+			p = FMA(p, m, VectorT( 2.0000714765e-1f));
+			p = FMA(p, m, VectorT(-2.4999993993e-1f));
+			p = FMA(p, m, VectorT( 3.3333331174e-1f));
+			p *= m * z;
+
+			p = FMA(e, VectorT(-2.12194440e-4f), p);
+			p = FMA(z, VectorT(-0.5f), p);
+			VectorT result = FMA(e, VectorT(0.693359375f), m + p);
+
+			constexpr F32 inf = std::numeric_limits< F32 >::infinity();
+			constexpr F32 nan = std::numeric_limits< F32 >::quiet_NaN();
+			result = Select(x == VectorT(inf), x, result);
+			result = Select(x == VectorT(0.0f), VectorT(-inf), result);
+			return Select((x < VectorT(0.0f)) | (x != x), VectorT(nan), result);
+		}
+
+		template< typename VectorT >
+		[[nodiscard]]
+		inline const std::pair< VectorT, VectorT > __vectorcall SinCos(const VectorT& x) noexcept {
+			const VectorT sign = SignBit(x);
+			const VectorT ax   = Abs(x);
+
+			// |x| = q * pi/2 + r, |r| <= pi/4 (Cody-Waite with pi/2 in 3 parts).
+			const VectorT q = Round(ax * 0.636619772367581343f);
+			VectorT r = FMA(q, VectorT(-1.5703125f), ax);
+			r = FMA(q, VectorT(-4.837512969970703125e-4f), r);
+			r = FMA(q, VectorT(-7.54978995489188216e-8f), r);
+
+			const VectorT z = r * r;
+
+			VectorT ps(-1.9515295891e-4f);
+			ps = FMA(ps, z, VectorT( 8.3321608736e-3f));
+			ps = FMA(ps, z, VectorT(-1.6666654611e-1f));
+			ps = FMA(ps * z, r, r);
+
+			VectorT pc(2.443315711809948e-5f);
+			pc = FMA(pc, z, VectorT(-1.388731625493765e-3f));
+			pc = FMA(pc, z, VectorT( 4.166664568298827e-2f));
+			pc = FMA(pc * z, z, FMA(z, VectorT(-0.5f), VectorT(1.0f)));
+
+			// Quadrant k = q mod 4:
+			// sin(|x|) = ( sin r,  cos r, -sin r, -cos r)[k]
+			// cos(|x|) = ( cos r, -sin r, -cos r,  sin r)[k]
+			const VectorT k = q - 4.0f * Floor(q * 0.25f);
+			const auto odd  = (k == VectorT(1.0f)) | (k == VectorT(3.0f));
+			const VectorT s = Select(odd, pc, ps);
+			const VectorT c = Select(odd, ps, pc);
+
+			const VectorT sin_sign = XorSign(SignBit(VectorT(1.0f) - k), sign);
+			const VectorT cos_sign = SignBit(Abs(k - 1.5f) - 1.0f);
+			return { XorSign(s, sin_sign), XorSign(c, cos_sign) };
+		}
+
+		template< typename VectorT >
+		[[nodiscard]]
+		inline const VectorT __vectorcall Atan2(const VectorT& y, const VectorT& x) noexcept {
+			constexpr F32 pi_2 = 1.57079632679489662f;
+			constexpr F32 pi_4 = 0.785398163397448310f;
+
+			const VectorT ax = Abs(x);
+			const VectorT ay = Abs(y);
+			const VectorT num = Min(ax, ay);
+			const VectorT den = Max(ax, ay);
+			// a in [0, 1]
+			VectorT a = Select(den == VectorT(0.0f), den, num / den);
+
+			// atan(a) = pi/4 + atan((a - 1) / (a + 1)) for a > tan(pi/8)
+			const auto large = a > VectorT(0.414213562373095049f);
+			a = Select(large, (a - 1.0f) / (a + 1.0f), a);
+
+			const VectorT z = a * a;
+			VectorT p(8.05374449538e-2f);
+			p = FMA(p, z, VectorT(-1.38776856032e-1f));
+			p = FMA(p, z, VectorT( 1.99777106478e-1f));
+			p = FMA(p, z, VectorT(-3.33329491539e-1f));
+			VectorT t = FMA(p * z, a, a) + Select(large, VectorT(pi_4), VectorT(0.0f));
+
+			t = Select(ay > ax, pi_2 - t, t);
+			t = Select(XorSign(VectorT(1.0f), SignBit(x)) < VectorT(0.0f), 2.0f * pi_2 - t, t);
+			return XorSign(t, SignBit(y));
+		}
+
+		template< typename VectorT >
+		[[nodiscard]]
+		inline const VectorT __vectorcall Pow(const VectorT& x, const VectorT& y) noexcept {
+			const VectorT result = Exp(y * Log(x));
+			return Select(y == VectorT(0.0f), VectorT(1.0f), result);
+		}
+
+		template< typename VectorT >
+		[[nodiscard]]
+		inline const VectorT __vectorcall Cosh(const VectorT& x) noexcept {
+			const VectorT ax = Abs(x);
+
+			// e^-|x| is negligible for |x| > 24 ln(2): cosh(x) = e^|x| / 2
+			// = (e^(|x|/2) / 2) e^(|x|/2) (which does not overflow prematurely).
+			const auto huge = ax > VectorT(16.6355323f);
+			const VectorT e = Exp(Select(huge, 0.5f * ax, ax));
+
+			// cosh(x) = (e^|x| + e^-|x|) / 2
+			return Select(huge, (0.5f * e) * e, 0.5f * (e + 1.0f / e));
+		}
+
+		template< typename VectorT >
+		[[nodiscard]]
+		inline const VectorT __vectorcall Sinh(const VectorT& x) noexcept {
+			const VectorT ax = Abs(x);
+
+			// See Cosh for large |x|.
+			const auto huge = ax > VectorT(16.6355323f);
+			const VectorT e = Exp(Select(huge, 0.5f * ax, ax));
+
+			// sinh(x) = (e^|x| - e^-|x|) / 2 suffers from cancellation for
+			// small |x|: use the Taylor series up to x^9 for |x| < 0.5.
+			const VectorT large = Select(huge, (0.5f * e) * e, 0.5f * (e - 1.0f / e));
+
+			const VectorT z = ax * ax;
+			VectorT p(2.7557319224e-6f);
+			p = FMA(p, z, VectorT(1.9841269841e-4f));
+			p = FMA(p, z, VectorT(8.3333333333e-3f));
+			p = FMA(p, z, VectorT(1.6666666667e-1f));
+			const VectorT small = FMA(p * z, ax, ax);
+
+			return XorSign(Select(ax < VectorT(0.5f), small, large), SignBit(x));
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// CopySign
+	//-------------------------------------------------------------------------
+
+	/**
+	 Computes the magnitude of @a x with the sign of @a sign component-wise.
+	 */
+	[[nodiscard]]
+	inline const F32x4S __vectorcall CopySign(const F32x4S& x, const F32x4S& sign) noexcept {
+		return details::XorSign(details::XorSign(x, details::SignBit(x)), details::SignBit(sign));
+	}
+	#ifdef MAML_HAS_AVX2_VECTORS
+	[[nodiscard]]
+	inline const F32x8S __vectorcall CopySign(const F32x8S& x, const F32x8S& sign) noexcept {
+		return details::XorSign(details::XorSign(x, details::SignBit(x)), details::SignBit(sign));
+	}
+	#endif
+
+	//-------------------------------------------------------------------------
+	// Exp
+	//-------------------------------------------------------------------------
+
+	/**
+	 Computes e^x component-wise.
+
+	 Max error: 1 ulp for normal results. Results below 2^-126 are subnormal
+	 (flushed to zero below 2^-150), results above FLT_MAX are +inf.
+	 */
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Exp(const F32x4S& x) noexcept {
+		return details::Exp(x);
+	}
+	#ifdef MAML_HAS_AVX2_VECTORS
+	[[nodiscard]]
+	inline const F32x8S __vectorcall Exp(const F32x8S& x) noexcept {
+		return details::Exp(x);
+	}
+	#endif
+
+	//-------------------------------------------------------------------------
+	// Log
+	//-------------------------------------------------------------------------
+
+	/**
+	 Computes the natural logarithm component-wise.
+
+	 Max error: 1 ulp. Log(0) = -inf, Log(+inf) = +inf, and Log(x) = NaN for
+	 negative and NaN x.
+	 */
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Log(const F32x4S& x) noexcept {
+		return details::Log(x);
+	}
+	#ifdef MAML_HAS_AVX2_VECTORS
+	[[nodiscard]]
+	inline const F32x8S __vectorcall Log(const F32x8S& x) noexcept {
+		return details::Log(x);
+	}
+	#endif
+
+	/**
+	 Computes the natural logarithm component-wise (see Log).
+	 */
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Ln(const F32x4S& x) noexcept {
+		return details::Log(x);
+	}
+	#ifdef MAML_HAS_AVX2_VECTORS
+	[[nodiscard]]
+	inline const F32x8S __vectorcall Ln(const F32x8S& x) noexcept {
+		return details::Log(x);
+	}
+	#endif
+
+	//-------------------------------------------------------------------------
+	// Sin, Cos and SinCos
+	//-------------------------------------------------------------------------
+
+	/**
+	 Computes the sine and cosine component-wise.
+
+	 The argument is reduced modulo pi/2 with a three-part Cody-Waite
+	 reduction. Max error: 2 ulp for |x| <= 8192, where results of magnitude
+	 below 1 are measured in absolute units of 2^-24. The accuracy degrades
+	 gradually for larger |x|.
+	 */
+	[[nodiscard]]
+	inline const std::pair< F32x4S, F32x4S > __vectorcall SinCos(const F32x4S& x) noexcept {
+		return details::SinCos(x);
+	}
+	#ifdef MAML_HAS_AVX2_VECTORS
+	[[nodiscard]]
+	inline const std::pair< F32x8S, F32x8S > __vectorcall SinCos(const F32x8S& x) noexcept {
+		return details::SinCos(x);
+	}
+	#endif
+
+	/**
+	 Computes the sine component-wise (see SinCos for the accuracy).
+	 */
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Sin(const F32x4S& x) noexcept {
+		return details::SinCos(x).first;
+	}
+	#ifdef MAML_HAS_AVX2_VECTORS
+	[[nodiscard]]
+	inline const F32x8S __vectorcall Sin(const F32x8S& x) noexcept {
+		return details::SinCos(x).first;
+	}
+	#endif
+
+	/**
+	 Computes the cosine component-wise (see SinCos for the accuracy).
+	 */
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Cos(const F32x4S& x) noexcept {
+		return details::SinCos(x).second;
+	}
+	#ifdef MAML_HAS_AVX2_VECTORS
+	[[nodiscard]]
+	inline const F32x8S __vectorcall Cos(const F32x8S& x) noexcept {
+		return details::SinCos(x).second;
+	}
+	#endif
+
+	//-------------------------------------------------------------------------
+	// Atan2
+	//-------------------------------------------------------------------------
+
+	/**
+	 Computes the arc tangent of y/x component-wise, using the signs of both
+	 arguments to determine the quadrant.
+
+	 Max error: 4 ulp. Atan2(+-0, +-0) = +-0 (or +-pi for negative x).
+	 */
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Atan2(const F32x4S& y, const F32x4S& x) noexcept {
+		return details::Atan2(y, x);
+	}
+	#ifdef MAML_HAS_AVX2_VECTORS
+	[[nodiscard]]
+	inline const F32x8S __vectorcall Atan2(const F32x8S& y, const F32x8S& x) noexcept {
+		return details::Atan2(y, x);
+	}
+	#endif
+
+	//-------------------------------------------------------------------------
+	// Pow
+	//-------------------------------------------------------------------------
+
+	/**
+	 Computes x^y = e^(y * ln(x)) component-wise for non-negative x.
+
+	 The error grows with the magnitude of the exponent and is bounded by
+	 about 1 + 2 * |y * ln(x)| ulp. Pow(x, 0) = 1, and Pow(x, y) = NaN for
+	 negative x.
+	 */
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Pow(const F32x4S& x, const F32x4S& y) noexcept {
+		return details::Pow(x, y);
+	}
+	#ifdef MAML_HAS_AVX2_VECTORS
+	[[nodiscard]]
+	inline const F32x8S __vectorcall Pow(const F32x8S& x, const F32x8S& y) noexcept {
+		return details::Pow(x, y);
+	}
+	#endif
+
+	//-------------------------------------------------------------------------
+	// Cosh and Sinh
+	//-------------------------------------------------------------------------
+
+	/**
+	 Computes the hyperbolic cosine component-wise.
+
+	 Max error: 3 ulp. Results above FLT_MAX are +inf.
+	 */
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Cosh(const F32x4S& x) noexcept {
+		return details::Cosh(x);
+	}
+	#ifdef MAML_HAS_AVX2_VECTORS
+	[[nodiscard]]
+	inline const F32x8S __vectorcall Cosh(const F32x8S& x) noexcept {
+		return details::Cosh(x);
+	}
+	#endif
+
+	/**
+	 Computes the hyperbolic sine component-wise.
+
+	 Max error: 3 ulp. Results beyond +-FLT_MAX are +-inf.
+	 */
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Sinh(const F32x4S& x) noexcept {
+		return details::Sinh(x);
+	}
+	#ifdef MAML_HAS_AVX2_VECTORS
+	[[nodiscard]]
+	inline const F32x8S __vectorcall Sinh(const F32x8S& x) noexcept {
+		return details::Sinh(x);
+	}
+	#endif
+}
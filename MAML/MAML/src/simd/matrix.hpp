@@ -0,0 +1,319 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "simd\swizzle.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <immintrin.h>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	//-------------------------------------------------------------------------
+	// F32x4x4S
+	//-------------------------------------------------------------------------
+
+	/**
+	 A 4x4 matrix of floating points with width of exactly 32 bits, stored in
+	 column-major order as four F32x4S columns. See algebra\matrix.hpp for the
+	 constexpr scalar twin operating on F32x4x4.
+	 */
+	struct alignas(16) F32x4x4S {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		explicit F32x4x4S(F32 diagonal = 0.0f) noexcept
+			: F32x4x4S(F32x4S(diagonal, 0.0f, 0.0f, 0.0f),
+					   F32x4S(0.0f, diagonal, 0.0f, 0.0f),
+					   F32x4S(0.0f, 0.0f, diagonal, 0.0f),
+					   F32x4S(0.0f, 0.0f, 0.0f, diagonal)) {}
+		F32x4x4S(const F32x4S& c0, const F32x4S& c1,
+				 const F32x4S& c2, const F32x4S& c3) noexcept
+			: m_c{ c0, c1, c2, c3 } {}
+		explicit F32x4x4S(const F32x4x4& m) noexcept
+			: F32x4x4S(F32x4S(m[0u]), F32x4S(m[1u]), F32x4S(m[2u]), F32x4S(m[3u])) {}
+		explicit F32x4x4S(const F32x4x4A& m) noexcept
+			: F32x4x4S(F32x4S(m[0u]), F32x4S(m[1u]), F32x4S(m[2u]), F32x4S(m[3u])) {}
+
+		F32x4x4S(const F32x4x4S& m) noexcept = default;
+		F32x4x4S(F32x4x4S&& m) noexcept = default;
+		~F32x4x4S() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		F32x4x4S& operator=(const F32x4x4S& m) noexcept = default;
+		F32x4x4S& operator=(F32x4x4S&& m) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		static const F32x4x4S __vectorcall Identity() noexcept {
+			return F32x4x4S(1.0f);
+		}
+
+		[[nodiscard]]
+		explicit operator F32x4x4() const noexcept {
+			return {
+				F32x4(m_c[0u]), F32x4(m_c[1u]), F32x4(m_c[2u]), F32x4(m_c[3u])
+			};
+		}
+
+		[[nodiscard]]
+		explicit operator F32x4x4A() const noexcept {
+			F32x4x4A m;
+			m_c[0u].Store(m[0u]);
+			m_c[1u].Store(m[1u]);
+			m_c[2u].Store(m[2u]);
+			m_c[3u].Store(m[3u]);
+			return m;
+		}
+
+		[[nodiscard]]
+		F32x4S& operator[](std::size_t c) noexcept {
+			return m_c[c];
+		}
+		[[nodiscard]]
+		const F32x4S& operator[](std::size_t c) const noexcept {
+			return m_c[c];
+		}
+
+		[[nodiscard]]
+		const F32x4x4S __vectorcall operator+(const F32x4x4S& m) const noexcept {
+			return {
+				m_c[0u] + m.m_c[0u], m_c[1u] + m.m_c[1u],
+				m_c[2u] + m.m_c[2u], m_c[3u] + m.m_c[3u]
+			};
+		}
+		[[nodiscard]]
+		const F32x4x4S __vectorcall operator-(const F32x4x4S& m) const noexcept {
+			return {
+				m_c[0u] - m.m_c[0u], m_c[1u] - m.m_c[1u],
+				m_c[2u] - m.m_c[2u], m_c[3u] - m.m_c[3u]
+			};
+		}
+		[[nodiscard]]
+		const F32x4x4S __vectorcall operator*(F32 a) const noexcept {
+			return { m_c[0u] * a, m_c[1u] * a, m_c[2u] * a, m_c[3u] * a };
+		}
+
+		/**
+		 Multiplies this matrix with the given column vector.
+		 */
+		[[nodiscard]]
+		const F32x4S __vectorcall operator*(const F32x4S& v) const noexcept {
+			// m * v = m[0] * v.x + m[1] * v.y + m[2] * v.z + m[3] * v.w
+			const F32x4S xy = FMA(m_c[0u], Swizzle< 0u, 0u, 0u, 0u >(v),
+								  m_c[1u] * Swizzle< 1u, 1u, 1u, 1u >(v));
+			const F32x4S zw = FMA(m_c[2u], Swizzle< 2u, 2u, 2u, 2u >(v),
+								  m_c[3u] * Swizzle< 3u, 3u, 3u, 3u >(v));
+			return xy + zw;
+		}
+
+		/**
+		 Multiplies this matrix with the given matrix.
+		 */
+		[[nodiscard]]
+		const F32x4x4S __vectorcall operator*(const F32x4x4S& m) const noexcept {
+			// (m1 * m2)[c] = m1 * m2[c]
+			return {
+				*this * m.m_c[0u], *this * m.m_c[1u],
+				*this * m.m_c[2u], *this * m.m_c[3u]
+			};
+		}
+
+		F32x4x4S& __vectorcall operator*=(const F32x4x4S& m) noexcept {
+			return *this = *this * m;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		F32x4S m_c[4u];
+	};
+
+	static_assert(64u == sizeof(F32x4x4S));
+
+	[[nodiscard]]
+	inline const F32x4x4S __vectorcall operator*(F32 a, const F32x4x4S& m) noexcept {
+		return m * a;
+	}
+
+	/**
+	 Transposes the given matrix.
+	 */
+	[[nodiscard]]
+	inline const F32x4x4S __vectorcall Transpose(const F32x4x4S& m) noexcept {
+		F32x4x4S result = m;
+		Transpose(result.m_c[0u], result.m_c[1u], result.m_c[2u], result.m_c[3u]);
+		return result;
+	}
+
+	namespace details {
+
+		// 2x2 matrices (a, b, c, d) = [a b; c d] packed in a single vector.
+
+		// m1 * m2
+		[[nodiscard]]
+		inline const F32x4S __vectorcall Mul2x2(const F32x4S& m1, const F32x4S& m2) noexcept {
+			return FMA(m1, Swizzle< 0u, 3u, 0u, 3u >(m2),
+					   Swizzle< 1u, 0u, 3u, 2u >(m1) * Swizzle< 2u, 1u, 2u, 1u >(m2));
+		}
+
+		// adjugate(m1) * m2
+		[[nodiscard]]
+		inline const F32x4S __vectorcall AdjMul2x2(const F32x4S& m1, const F32x4S& m2) noexcept {
+			return FMS(Swizzle< 3u, 3u, 0u, 0u >(m1), m2,
+					   Swizzle< 1u, 1u, 2u, 2u >(m1) * Swizzle< 2u, 3u, 0u, 1u >(m2));
+		}
+
+		// m1 * adjugate(m2)
+		[[nodiscard]]
+		inline const F32x4S __vectorcall MulAdj2x2(const F32x4S& m1, const F32x4S& m2) noexcept {
+			return FMS(m1, Swizzle< 3u, 0u, 3u, 0u >(m2),
+					   Swizzle< 1u, 0u, 3u, 2u >(m1) * Swizzle< 2u, 1u, 2u, 1u >(m2));
+		}
+	}
+
+	/**
+	 Computes the inverse of the given matrix using the block-wise inversion
+	 of its four 2x2 sub-matrices.
+
+	 @pre			The given matrix is invertible.
+	 */
+	[[nodiscard]]
+	inline const F32x4x4S __vectorcall Inverse(const F32x4x4S& m) noexcept {
+		using namespace details;
+
+		// The block-wise inversion operates on rows. Since
+		// inverse(transpose(m)) = transpose(inverse(m)), operating on the
+		// columns instead directly yields the columns of the inverse.
+		const F32x4S& r0 = m.m_c[0u];
+		const F32x4S& r1 = m.m_c[1u];
+		const F32x4S& r2 = m.m_c[2u];
+		const F32x4S& r3 = m.m_c[3u];
+
+		// m = [A B; C D]
+		const F32x4S A = Shuffle< 0u, 1u, 4u, 5u >(r0, r1);
+		const F32x4S B = Shuffle< 2u, 3u, 6u, 7u >(r0, r1);
+		const F32x4S C = Shuffle< 0u, 1u, 4u, 5u >(r2, r3);
+		const F32x4S D = Shuffle< 2u, 3u, 6u, 7u >(r2, r3);
+
+		// (|A|, |B|, |C|, |D|)
+		const F32x4S det_sub = FMS(Shuffle< 0u, 2u, 4u, 6u >(r0, r2),
+								   Shuffle< 1u, 3u, 5u, 7u >(r1, r3),
+								   Shuffle< 1u, 3u, 5u, 7u >(r0, r2)
+								   * Shuffle< 0u, 2u, 4u, 6u >(r1, r3));
+		const F32x4S det_A = Swizzle< 0u, 0u, 0u, 0u >(det_sub);
+		const F32x4S det_B = Swizzle< 1u, 1u, 1u, 1u >(det_sub);
+		const F32x4S det_C = Swizzle< 2u, 2u, 2u, 2u >(det_sub);
+		const F32x4S det_D = Swizzle< 3u, 3u, 3u, 3u >(det_sub);
+
+		const F32x4S D_C = AdjMul2x2(D, C);
+		const F32x4S A_B = AdjMul2x2(A, B);
+
+		// inverse(m) = 1/|m| * adjugate([X Y; Z W])
+		const F32x4S X = FMS(det_D, A, Mul2x2(B, D_C));
+		const F32x4S W = FMS(det_A, D, Mul2x2(C, A_B));
+		const F32x4S Y = FMS(det_B, C, MulAdj2x2(D, A_B));
+		const F32x4S Z = FMS(det_C, B, MulAdj2x2(A, D_C));
+
+		// |m| = |A| |D| + |B| |C| - tr(A#B D#C)
+		const F32x4S tr = HorizontalSum(A_B * Swizzle< 0u, 2u, 1u, 3u >(D_C));
+		const F32x4S det_M = FMA(det_A, det_D, FMS(det_B, det_C, tr));
+
+		const F32x4S inv_det = F32x4S(1.0f, -1.0f, -1.0f, 1.0f) / det_M;
+		const F32x4S X_ = X * inv_det;
+		const F32x4S Y_ = Y * inv_det;
+		const F32x4S Z_ = Z * inv_det;
+		const F32x4S W_ = W * inv_det;
+
+		return {
+			Shuffle< 3u, 1u, 7u, 5u >(X_, Y_),
+			Shuffle< 2u, 0u, 6u, 4u >(X_, Y_),
+			Shuffle< 3u, 1u, 7u, 5u >(Z_, W_),
+			Shuffle< 2u, 0u, 6u, 4u >(Z_, W_)
+		};
+	}
+
+	/**
+	 Computes the inverse of the given affine matrix.
+
+	 @pre			The given matrix is invertible and its last row is
+					(0, 0, 0, 1).
+	 */
+	[[nodiscard]]
+	inline const F32x4x4S __vectorcall InverseAffine(const F32x4x4S& m) noexcept {
+		// The rows of the inverse of the upper-left 3x3 block (m[0] m[1] m[2])
+		// are (m[1] x m[2], m[2] x m[0], m[0] x m[1]) / det.
+		const F32x4S x0 = Cross(m.m_c[1u], m.m_c[2u]);
+		const F32x4S inv_det = F32x4S(1.0f) / Dot(m.m_c[0u], x0);
+
+		F32x4S c0 = x0 * inv_det;
+		F32x4S c1 = Cross(m.m_c[2u], m.m_c[0u]) * inv_det;
+		F32x4S c2 = Cross(m.m_c[0u], m.m_c[1u]) * inv_det;
+		F32x4S c3(0.0f);
+		Transpose(c0, c1, c2, c3);
+
+		// The translation of the inverse is -inverse(block) * m[3].
+		const F32x4S& t = m.m_c[3u];
+		const F32x4S it = FMA(c0, Swizzle< 0u, 0u, 0u, 0u >(t),
+							  FMA(c1, Swizzle< 1u, 1u, 1u, 1u >(t),
+								  c2 * Swizzle< 2u, 2u, 2u, 2u >(t)));
+		c3 = Blend< 0x8u >(-it, F32x4S(1.0f));
+
+		return { c0, c1, c2, c3 };
+	}
+
+	/**
+	 Computes the determinant of the given matrix. The result is broadcast
+	 to all components.
+	 */
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Determinant(const F32x4x4S& m) noexcept {
+		using namespace details;
+
+		const F32x4S& r0 = m.m_c[0u];
+		const F32x4S& r1 = m.m_c[1u];
+		const F32x4S& r2 = m.m_c[2u];
+		const F32x4S& r3 = m.m_c[3u];
+
+		const F32x4S A = Shuffle< 0u, 1u, 4u, 5u >(r0, r1);
+		const F32x4S B = Shuffle< 2u, 3u, 6u, 7u >(r0, r1);
+		const F32x4S C = Shuffle< 0u, 1u, 4u, 5u >(r2, r3);
+		const F32x4S D = Shuffle< 2u, 3u, 6u, 7u >(r2, r3);
+
+		const F32x4S det_sub = FMS(Shuffle< 0u, 2u, 4u, 6u >(r0, r2),
+								   Shuffle< 1u, 3u, 5u, 7u >(r1, r3),
+								   Shuffle< 1u, 3u, 5u, 7u >(r0, r2)
+								   * Shuffle< 0u, 2u, 4u, 6u >(r1, r3));
+
+		// |m| = |A| |D| + |B| |C| - tr(A#B D#C)
+		const F32x4S tr = HorizontalSum(AdjMul2x2(A, B)
+										* Swizzle< 0u, 2u, 1u, 3u >(AdjMul2x2(D, C)));
+		const F32x4S ad_bc = det_sub * Swizzle< 3u, 2u, 1u, 0u >(det_sub);
+		return HorizontalSum(Blend< 0xCu >(ad_bc, F32x4S(0.0f))) - tr;
+	}
+}
@@ -0,0 +1,277 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "algebra\quaternion.hpp"
+#include "simd\math.hpp"
+#include "simd\matrix.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	//-------------------------------------------------------------------------
+	// Q32S
+	//-------------------------------------------------------------------------
+
+	/**
+	 A quaternion (X, Y, Z, W) = W + X i + Y j + Z k of floating points with
+	 width of exactly 32 bits, stored in a single F32x4S. See
+	 algebra\quaternion.hpp for the constexpr scalar twin.
+	 */
+	struct alignas(16) Q32S {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		Q32S() noexcept
+			: Q32S(0.0f, 0.0f, 0.0f, 1.0f) {}
+		Q32S(F32 x, F32 y, F32 z, F32 w) noexcept
+			: m_v(x, y, z, w) {}
+		explicit Q32S(const Q32& q) noexcept
+			: m_v(static_cast< const F32x4& >(q)) {}
+		explicit Q32S(const F32x4S& v) noexcept
+			: m_v(v) {}
+
+		Q32S(const Q32S& q) noexcept = default;
+		Q32S(Q32S&& q) noexcept = default;
+		~Q32S() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		Q32S& operator=(const Q32S& q) noexcept = default;
+		Q32S& operator=(Q32S&& q) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Factory Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		static const Q32S __vectorcall Identity() noexcept {
+			return {};
+		}
+
+		/**
+		 Constructs the rotation of the given angle (in radians) around the
+		 given normalized axis.
+		 */
+		[[nodiscard]]
+		static const Q32S __vectorcall FromAxisAngle(const F32x3& axis, F32 angle) noexcept {
+			const auto [s, c] = SinCos(F32x4S(0.5f * angle));
+			const F32x4S v(axis[0u], axis[1u], axis[2u], 0.0f);
+			return Q32S(Blend< 0x8u >(v * s, c));
+		}
+
+		/**
+		 Constructs the rotation of the upper-left 3x3 block of the given
+		 (column-major) rotation matrix.
+		 */
+		[[nodiscard]]
+		static const Q32S __vectorcall FromMatrix(const F32x4x4S& m) noexcept {
+			return Q32S(Q32::FromMatrix(static_cast< F32x4x4 >(m)));
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		explicit operator Q32() const noexcept {
+			const F32x4 v(m_v);
+			return { v[0u], v[1u], v[2u], v[3u] };
+		}
+
+		[[nodiscard]]
+		F32 __vectorcall X() const noexcept {
+			return m_v.X();
+		}
+		[[nodiscard]]
+		F32 __vectorcall Y() const noexcept {
+			return m_v.Y();
+		}
+		[[nodiscard]]
+		F32 __vectorcall Z() const noexcept {
+			return m_v.Z();
+		}
+		[[nodiscard]]
+		F32 __vectorcall W() const noexcept {
+			return m_v.W();
+		}
+
+		[[nodiscard]]
+		const Q32S __vectorcall operator-() const noexcept {
+			return Q32S(-m_v);
+		}
+
+		[[nodiscard]]
+		const Q32S __vectorcall operator+(const Q32S& q) const noexcept {
+			return Q32S(m_v + q.m_v);
+		}
+		[[nodiscard]]
+		const Q32S __vectorcall operator-(const Q32S& q) const noexcept {
+			return Q32S(m_v - q.m_v);
+		}
+		[[nodiscard]]
+		const Q32S __vectorcall operator*(F32 a) const noexcept {
+			return Q32S(m_v * a);
+		}
+
+		/**
+		 Computes the Hamilton product of this quaternion and the given
+		 quaternion.
+		 */
+		[[nodiscard]]
+		const Q32S __vectorcall operator*(const Q32S& q) const noexcept {
+			// (V, W) * (q.V, q.W) = W   * ( q.X,  q.Y,  q.Z,  q.W)
+			//                     + X   * ( q.W, -q.Z,  q.Y, -q.X)
+			//                     + Y   * ( q.Z,  q.W, -q.X, -q.Y)
+			//                     + Z   * (-q.Y,  q.X,  q.W, -q.Z)
+			const F32x4S& v = q.m_v;
+			const F32x4S x = Swizzle< 3u, 2u, 1u, 0u >(v) * F32x4S( 1.0f, -1.0f,  1.0f, -1.0f);
+			const F32x4S y = Swizzle< 2u, 3u, 0u, 1u >(v) * F32x4S( 1.0f,  1.0f, -1.0f, -1.0f);
+			const F32x4S z = Swizzle< 1u, 0u, 3u, 2u >(v) * F32x4S(-1.0f,  1.0f,  1.0f, -1.0f);
+
+			F32x4S result = Swizzle< 3u, 3u, 3u, 3u >(m_v) * v;
+			result = FMA(Swizzle< 0u, 0u, 0u, 0u >(m_v), x, result);
+			result = FMA(Swizzle< 1u, 1u, 1u, 1u >(m_v), y, result);
+			result = FMA(Swizzle< 2u, 2u, 2u, 2u >(m_v), z, result);
+			return Q32S(result);
+		}
+
+		Q32S& __vectorcall operator*=(const Q32S& q) noexcept {
+			return *this = *this * q;
+		}
+
+		[[nodiscard]]
+		const Q32S __vectorcall Conjugate() const noexcept {
+			return Q32S(m_v * F32x4S(-1.0f, -1.0f, -1.0f, 1.0f));
+		}
+
+		[[nodiscard]]
+		const Q32S __vectorcall Inverse() const noexcept {
+			return Q32S(Conjugate().m_v / Dot(m_v, m_v));
+		}
+
+		/**
+		 Rotates the given vector by this (normalized) quaternion. The fourth
+		 component of the given vector is passed through.
+		 */
+		[[nodiscard]]
+		const F32x4S __vectorcall Rotate(const F32x4S& v) const noexcept {
+			// t = 2 (V x v), v' = v + W t + V x t
+			const F32x4S t = Cross(m_v, v) * 2.0f;
+			return FMA(Swizzle< 3u, 3u, 3u, 3u >(m_v), t, v + Cross(m_v, t));
+		}
+
+		/**
+		 Rotates the given vector by this (normalized) quaternion.
+		 */
+		[[nodiscard]]
+		const F32x3 __vectorcall Rotate(const F32x3& v) const noexcept {
+			const F32x4 r(Rotate(F32x4S(v[0u], v[1u], v[2u], 0.0f)));
+			return { r[0u], r[1u], r[2u] };
+		}
+
+		/**
+		 Converts this (normalized) quaternion to a column-major rotation
+		 matrix.
+		 */
+		[[nodiscard]]
+		const F32x4x4S __vectorcall ToMatrix() const noexcept {
+			// The columns of the rotation matrix are the rotated basis vectors.
+			const F32x4S x2 = m_v + m_v;
+			const F32x4S w2 = Swizzle< 3u, 3u, 3u, 3u >(x2);
+			// (yy, xx, xx) and (zz, zz, yy)
+			const F32x4S sqr0 = Swizzle< 1u, 0u, 0u, 3u >(m_v) * Swizzle< 1u, 0u, 0u, 3u >(x2);
+			const F32x4S sqr1 = Swizzle< 2u, 2u, 1u, 3u >(m_v) * Swizzle< 2u, 2u, 1u, 3u >(x2);
+			// (1 - 2(yy + zz), 1 - 2(xx + zz), 1 - 2(xx + yy))
+			const F32x4S diagonal = F32x4S(1.0f) - sqr0 - sqr1;
+			// (2xy, 2yz, 2xz) and (2wz, 2wx, 2wy)
+			const F32x4S mix = m_v * Swizzle< 1u, 2u, 0u, 3u >(x2);
+			const F32x4S wv  = w2 * Swizzle< 2u, 0u, 1u, 3u >(m_v);
+			const F32x4S sum = mix + wv; // (xy + wz, yz + wx, xz + wy)
+			const F32x4S dif = mix - wv; // (xy - wz, yz - wx, xz - wy)
+
+			const F32x4 d(diagonal);
+			const F32x4 s(sum);
+			const F32x4 f(dif);
+			return {
+				F32x4S(d[0u], s[0u], f[2u], 0.0f),
+				F32x4S(f[0u], d[1u], s[1u], 0.0f),
+				F32x4S(s[2u], f[1u], d[2u], 0.0f),
+				F32x4S(0.0f, 0.0f, 0.0f, 1.0f)
+			};
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		F32x4S m_v;
+	};
+
+	static_assert(16u == sizeof(Q32S));
+
+	/**
+	 Computes the dot product of the given quaternions. The result is
+	 broadcast to all components.
+	 */
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Dot(const Q32S& a, const Q32S& b) noexcept {
+		return Dot(a.m_v, b.m_v);
+	}
+
+	/**
+	 Normalizes the given quaternion using a Newton-Raphson refined
+	 reciprocal square root (relative error below 2^-22).
+	 */
+	[[nodiscard]]
+	inline const Q32S __vectorcall Normalize(const Q32S& q) noexcept {
+		return Q32S(q.m_v * Rsqrt< true >(Dot(q.m_v, q.m_v)));
+	}
+
+	/**
+	 Linearly interpolates the given normalized quaternions along the
+	 shortest path and normalizes the result.
+	 */
+	[[nodiscard]]
+	inline const Q32S __vectorcall Nlerp(const Q32S& a, const Q32S& b, F32 t) noexcept {
+		const F32x4S sign = details::SignBit(Dot(a.m_v, b.m_v));
+		const F32x4S sb   = details::XorSign(b.m_v, sign);
+		return Normalize(Q32S(FMA(sb - a.m_v, F32x4S(t), a.m_v)));
+	}
+
+	/**
+	 Spherically interpolates the given normalized quaternions along the
+	 shortest path. Falls back to Nlerp for nearly parallel quaternions.
+	 */
+	[[nodiscard]]
+	inline const Q32S __vectorcall Slerp(const Q32S& a, const Q32S& b, F32 t) noexcept {
+		const F32x4S d    = Dot(a.m_v, b.m_v);
+		const F32x4S sign = details::SignBit(d);
+		const F32x4S sb   = details::XorSign(b.m_v, sign);
+		const F32x4S c    = Abs(d);
+
+		// (sin((1 - t) theta), sin(t theta)) / sin(theta)
+		const F32x4S s      = Sqrt(Max(F32x4S(1.0f) - c * c, F32x4S(0.0f)));
+		const F32x4S theta  = Atan2(s, c);
+		const F32x4S linear(1.0f - t, t, 0.0f, 0.0f);
+		const F32x4S weights = Select(c > F32x4S(0.9995f), linear,
+									  Sin(theta * linear) / s);
+
+		const F32x4S result = FMA(a.m_v, Swizzle< 0u, 0u, 0u, 0u >(weights),
+								  sb * Swizzle< 1u, 1u, 1u, 1u >(weights));
+		return Normalize(Q32S(result));
+	}
+}
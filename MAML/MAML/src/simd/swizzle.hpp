@@ -0,0 +1,216 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "simd\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <immintrin.h>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	//-------------------------------------------------------------------------
+	// Blend
+	//-------------------------------------------------------------------------
+
+	/**
+	 Blends the given vectors: component i is taken from @a b if bit i of
+	 @a Mask is set, and from @a a otherwise.
+	 */
+	template< U32 Mask >
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Blend(const F32x4S& a, const F32x4S& b) noexcept {
+		static_assert(Mask <= 0xFu);
+
+		if constexpr (0x0u == Mask) {
+			return a;
+		}
+		else if constexpr (0xFu == Mask) {
+			return b;
+		}
+		else if constexpr (0x1u == Mask) {
+			return _mm_move_ss(a.m_v, b.m_v);
+		}
+		else {
+			#if defined(__SSE4_1__) || defined(__AVX__)
+			return _mm_blend_ps(a.m_v, b.m_v, Mask);
+			#else
+			const __m128 mask = _mm_castsi128_ps(_mm_setr_epi32(
+				(Mask & 0x1u) ? -1 : 0, (Mask & 0x2u) ? -1 : 0,
+				(Mask & 0x4u) ? -1 : 0, (Mask & 0x8u) ? -1 : 0));
+			return _mm_or_ps(_mm_and_ps(mask, b.m_v), _mm_andnot_ps(mask, a.m_v));
+			#endif
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// Swizzle
+	//-------------------------------------------------------------------------
+
+	/**
+	 Swizzles the given vector: component i of the result is component Ii
+	 of @a v.
+	 */
+	template< U32 I0, U32 I1, U32 I2, U32 I3 >
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Swizzle(const F32x4S& v) noexcept {
+		static_assert(I0 < 4u && I1 < 4u && I2 < 4u && I3 < 4u);
+
+		#define MAML_IS_SWIZZLE(i0, i1, i2, i3) \
+			(i0 == I0 && i1 == I1 && i2 == I2 && i3 == I3)
+
+		if constexpr (MAML_IS_SWIZZLE(0u, 1u, 2u, 3u)) {
+			return v;
+		}
+		else if constexpr (MAML_IS_SWIZZLE(0u, 1u, 0u, 1u)) {
+			return _mm_movelh_ps(v.m_v, v.m_v);
+		}
+		else if constexpr (MAML_IS_SWIZZLE(2u, 3u, 2u, 3u)) {
+			return _mm_movehl_ps(v.m_v, v.m_v);
+		}
+		else if constexpr (MAML_IS_SWIZZLE(0u, 0u, 1u, 1u)) {
+			return _mm_unpacklo_ps(v.m_v, v.m_v);
+		}
+		else if constexpr (MAML_IS_SWIZZLE(2u, 2u, 3u, 3u)) {
+			return _mm_unpackhi_ps(v.m_v, v.m_v);
+		}
+		#if defined(__SSE3__) || defined(__AVX__)
+		else if constexpr (MAML_IS_SWIZZLE(0u, 0u, 2u, 2u)) {
+			return _mm_moveldup_ps(v.m_v);
+		}
+		else if constexpr (MAML_IS_SWIZZLE(1u, 1u, 3u, 3u)) {
+			return _mm_movehdup_ps(v.m_v);
+		}
+		#endif
+		#ifdef __AVX2__
+		else if constexpr (MAML_IS_SWIZZLE(0u, 0u, 0u, 0u)) {
+			return _mm_broadcastss_ps(v.m_v);
+		}
+		#endif
+		else {
+			return _mm_shuffle_ps(v.m_v, v.m_v, _MM_SHUFFLE(I3, I2, I1, I0));
+		}
+
+		#undef MAML_IS_SWIZZLE
+	}
+
+	//-------------------------------------------------------------------------
+	// Shuffle
+	//-------------------------------------------------------------------------
+
+	/**
+	 Shuffles the given vectors: component i of the result is component Ii
+	 of @a a if Ii < 4, and component Ii - 4 of @a b otherwise.
+	 */
+	template< U32 I0, U32 I1, U32 I2, U32 I3 >
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Shuffle(const F32x4S& a, const F32x4S& b) noexcept {
+		static_assert(I0 < 8u && I1 < 8u && I2 < 8u && I3 < 8u);
+
+		#define MAML_IS_SHUFFLE(i0, i1, i2, i3) \
+			(i0 == I0 && i1 == I1 && i2 == I2 && i3 == I3)
+
+		constexpr U32 from_b = (I0 >> 2u) | ((I1 >> 2u) << 1u)
+			                 | ((I2 >> 2u) << 2u) | ((I3 >> 2u) << 3u);
+
+		if constexpr (0x0u == from_b) {
+			return Swizzle< I0, I1, I2, I3 >(a);
+		}
+		else if constexpr (0xFu == from_b) {
+			return Swizzle< I0 - 4u, I1 - 4u, I2 - 4u, I3 - 4u >(b);
+		}
+		else if constexpr (MAML_IS_SHUFFLE(0u, 1u, 4u, 5u)) {
+			return _mm_movelh_ps(a.m_v, b.m_v);
+		}
+		else if constexpr (MAML_IS_SHUFFLE(4u, 5u, 0u, 1u)) {
+			return _mm_movelh_ps(b.m_v, a.m_v);
+		}
+		else if constexpr (MAML_IS_SHUFFLE(6u, 7u, 2u, 3u)) {
+			return _mm_movehl_ps(a.m_v, b.m_v);
+		}
+		else if constexpr (MAML_IS_SHUFFLE(2u, 3u, 6u, 7u)) {
+			return _mm_movehl_ps(b.m_v, a.m_v);
+		}
+		else if constexpr (MAML_IS_SHUFFLE(0u, 4u, 1u, 5u)) {
+			return _mm_unpacklo_ps(a.m_v, b.m_v);
+		}
+		else if constexpr (MAML_IS_SHUFFLE(4u, 0u, 5u, 1u)) {
+			return _mm_unpacklo_ps(b.m_v, a.m_v);
+		}
+		else if constexpr (MAML_IS_SHUFFLE(2u, 6u, 3u, 7u)) {
+			return _mm_unpackhi_ps(a.m_v, b.m_v);
+		}
+		else if constexpr (MAML_IS_SHUFFLE(6u, 2u, 7u, 3u)) {
+			return _mm_unpackhi_ps(b.m_v, a.m_v);
+		}
+		else if constexpr (0u == I0 % 4u && 1u == I1 % 4u
+			            && 2u == I2 % 4u && 3u == I3 % 4u) {
+			return Blend< from_b >(a, b);
+		}
+		else if constexpr (0xCu == from_b) {
+			return _mm_shuffle_ps(a.m_v, b.m_v,
+								  _MM_SHUFFLE(I3 - 4u, I2 - 4u, I1, I0));
+		}
+		else if constexpr (0x3u == from_b) {
+			return _mm_shuffle_ps(b.m_v, a.m_v,
+								  _MM_SHUFFLE(I3, I2, I1 - 4u, I0 - 4u));
+		}
+		else {
+			const F32x4S sa = Swizzle< I0 % 4u, I1 % 4u, I2 % 4u, I3 % 4u >(a);
+			const F32x4S sb = Swizzle< I0 % 4u, I1 % 4u, I2 % 4u, I3 % 4u >(b);
+			return Blend< from_b >(sa, sb);
+		}
+
+		#undef MAML_IS_SHUFFLE
+	}
+
+	//-------------------------------------------------------------------------
+	// Swizzle-based Operations
+	//-------------------------------------------------------------------------
+
+	/**
+	 Computes the cross product of the first three components of the given
+	 vectors. The fourth component of the result is zero.
+	 */
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Cross(const F32x4S& a, const F32x4S& b) noexcept {
+		// (a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x)
+		const F32x4S a_yzx = Swizzle< 1u, 2u, 0u, 3u >(a);
+		const F32x4S b_yzx = Swizzle< 1u, 2u, 0u, 3u >(b);
+		const F32x4S c_zxy = FMS(a, b_yzx, a_yzx * b);
+		// With FMA, a.w * b.w - round(a.w * b.w) is the rounding error of
+		// the product rather than zero: clear the fourth component.
+		const __m128 xyz = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		return _mm_and_ps(Swizzle< 1u, 2u, 0u, 3u >(c_zxy).m_v, xyz);
+	}
+
+	/**
+	 Transposes the 4x4 matrix with the given rows in place.
+	 */
+	inline void __vectorcall Transpose(F32x4S& r0, F32x4S& r1,
+									   F32x4S& r2, F32x4S& r3) noexcept {
+		// (r0.x, r1.x, r0.y, r1.y), (r2.x, r3.x, r2.y, r3.y), ...
+		const F32x4S t0 = Shuffle< 0u, 4u, 1u, 5u >(r0, r1);
+		const F32x4S t1 = Shuffle< 0u, 4u, 1u, 5u >(r2, r3);
+		const F32x4S t2 = Shuffle< 2u, 6u, 3u, 7u >(r0, r1);
+		const F32x4S t3 = Shuffle< 2u, 6u, 3u, 7u >(r2, r3);
+		r0 = Shuffle< 0u, 1u, 4u, 5u >(t0, t1);
+		r1 = Shuffle< 2u, 3u, 6u, 7u >(t0, t1);
+		r2 = Shuffle< 0u, 1u, 4u, 5u >(t2, t3);
+		r3 = Shuffle< 2u, 3u, 6u, 7u >(t2, t3);
+	}
+}
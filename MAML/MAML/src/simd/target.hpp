@@ -0,0 +1,65 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Instruction Set Targets
+//-----------------------------------------------------------------------------
+
+// The library is compiled for the SSE2 baseline. Code that is only executed
+// at a higher SIMD level (see GetSIMDLevel) is compiled for that level with
+// the following macros, so that no instructions beyond SSE2 leak into the
+// code executed on older processors.
+//
+// MSVC accepts the intrinsics of every instruction set regardless of /arch,
+// so the macros are empty. GCC and Clang require the instruction set to be
+// enabled per function: MAML_TARGET_SSE4_1, MAML_TARGET_AVX2 and
+// MAML_TARGET_AVX512 compile a single function for the given level, and
+// inline all calls into it, so that the (generic) kernels it calls are
+// compiled for that level as well.
+//
+// The AVX2 level includes FMA (see DetectSIMDLevel).
+
+#if defined(__clang__) || defined(__GNUC__)
+
+	#define MAML_TARGET_SSE4_1 __attribute__((target("sse4.1"), flatten))
+	#define MAML_TARGET_AVX2   __attribute__((target("avx2,fma"), flatten))
+	#define MAML_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma"), flatten))
+
+#else
+
+	#define MAML_TARGET_SSE4_1
+	#define MAML_TARGET_AVX2
+	#define MAML_TARGET_AVX512
+
+#endif
+
+// MAML_HAS_AVX2_VECTORS is defined if the 256-bit vector types (F32x8S,
+// F64x4S and their masks) are available. GCC and Clang pass and return
+// these in registers only between functions compiled with AVX, so they
+// require AVX2 and FMA to be enabled for the whole translation unit
+// (-mavx2 -mfma). MSVC always provides them; executing them still requires
+// the AVX2 level.
+
+#if (defined(__AVX2__) && defined(__FMA__)) || (defined(_MSC_VER) && !defined(__clang__))
+
+	#define MAML_HAS_AVX2_VECTORS
+
+#endif
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	namespace details {
+
+		// Invokes the given function object compiled for the SSE4.1 level.
+		// The dispatchers use this to run the generic F32x4S kernels at the
+		// SSE4.1 level.
+
+		template< typename FunctionT >
+		MAML_TARGET_SSE4_1
+		inline void InvokeSSE4_1(FunctionT&& function) noexcept {
+			function();
+		}
+	}
+}
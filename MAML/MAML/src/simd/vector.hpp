@@ -5,6 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "simd\target.hpp"
 #include "type\types.hpp"
 
 #pragma endregion
@@ -24,6 +25,88 @@
 //-----------------------------------------------------------------------------
 namespace maml {
 
+	struct alignas(16) Mask4 {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		explicit Mask4(bool value = false) noexcept
+			: Mask4(_mm_castsi128_ps(_mm_set1_epi32(value ? -1 : 0))) {}
+		Mask4(__m128 v) noexcept
+			: m_v(v) {}
+
+		Mask4(const Mask4& v) noexcept = default;
+		Mask4(Mask4&& v) noexcept = default;
+		~Mask4() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		Mask4& operator=(const Mask4& v) noexcept = default;
+		Mask4& operator=(Mask4&& v) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		const Mask4 __vectorcall operator~() const noexcept {
+			return _mm_xor_ps(m_v, Mask4(true).m_v);
+		}
+
+		[[nodiscard]]
+		const Mask4 __vectorcall operator&(const Mask4& v) const noexcept {
+			return _mm_and_ps(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const Mask4 __vectorcall operator|(const Mask4& v) const noexcept {
+			return _mm_or_ps(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const Mask4 __vectorcall operator^(const Mask4& v) const noexcept {
+			return _mm_xor_ps(m_v, v.m_v);
+		}
+
+		Mask4& __vectorcall operator&=(const Mask4& v) noexcept {
+			m_v = _mm_and_ps(m_v, v.m_v);
+			return *this;
+		}
+		Mask4& __vectorcall operator|=(const Mask4& v) noexcept {
+			m_v = _mm_or_ps(m_v, v.m_v);
+			return *this;
+		}
+		Mask4& __vectorcall operator^=(const Mask4& v) noexcept {
+			m_v = _mm_xor_ps(m_v, v.m_v);
+			return *this;
+		}
+
+		__m128 m_v;
+	};
+
+	/**
+	 Returns a bit mask with bit i set if component i of the given mask is set.
+	 */
+	[[nodiscard]]
+	inline U32 __vectorcall MoveMask(const Mask4& m) noexcept {
+		return static_cast< U32 >(_mm_movemask_ps(m.m_v));
+	}
+	[[nodiscard]]
+	inline bool __vectorcall Any(const Mask4& m) noexcept {
+		return 0u != MoveMask(m);
+	}
+	[[nodiscard]]
+	inline bool __vectorcall All(const Mask4& m) noexcept {
+		return 0xFu == MoveMask(m);
+	}
+	[[nodiscard]]
+	inline bool __vectorcall None(const Mask4& m) noexcept {
+		return 0u == MoveMask(m);
+	}
+
 	struct alignas(16) F32x4S {
 
 	public:
@@ -37,7 +120,9 @@ namespace maml {
 		F32x4S(F32 x, F32 y, F32 z, F32 w) noexcept
 			: F32x4S(_mm_set_ps(w, z, y, x)) {}
 		F32x4S(const F32x4& v) noexcept
-			: F32x4S(v[0u], v[1u], v[2u], v[3u]) {}
+			: F32x4S(_mm_loadu_ps(v.data())) {}
+		F32x4S(const F32x4A& v) noexcept
+			: F32x4S(_mm_load_ps(v.data())) {}
 		F32x4S(__m128 v) noexcept
 			: m_v(v) {}
 		
@@ -52,25 +137,92 @@ namespace maml {
 		F32x4S& operator=(const F32x4S& v) noexcept = default;
 		F32x4S& operator=(F32x4S&& v) noexcept = default;
 
+		//---------------------------------------------------------------------
+		// Load and Store Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Loads a vector from the given 16-byte aligned memory.
+		 */
+		[[nodiscard]]
+		static const F32x4S __vectorcall Load(const F32* p) noexcept {
+			return _mm_load_ps(p);
+		}
+		[[nodiscard]]
+		static const F32x4S __vectorcall Load(const F32x4A& v) noexcept {
+			return _mm_load_ps(v.data());
+		}
+
+		/**
+		 Loads a vector from the given (possibly unaligned) memory.
+		 */
+		[[nodiscard]]
+		static const F32x4S __vectorcall LoadUnaligned(const F32* p) noexcept {
+			return _mm_loadu_ps(p);
+		}
+		[[nodiscard]]
+		static const F32x4S __vectorcall LoadUnaligned(const F32x4& v) noexcept {
+			return _mm_loadu_ps(v.data());
+		}
+
+		/**
+		 Stores this vector to the given 16-byte aligned memory.
+		 */
+		void __vectorcall Store(F32* p) const noexcept {
+			_mm_store_ps(p, m_v);
+		}
+		void __vectorcall Store(F32x4A& v) const noexcept {
+			_mm_store_ps(v.data(), m_v);
+		}
+
+		/**
+		 Stores this vector to the given (possibly unaligned) memory.
+		 */
+		void __vectorcall StoreUnaligned(F32* p) const noexcept {
+			_mm_storeu_ps(p, m_v);
+		}
+		void __vectorcall StoreUnaligned(F32x4& v) const noexcept {
+			_mm_storeu_ps(v.data(), m_v);
+		}
+
+		/**
+		 Stores this vector to the given 16-byte aligned memory with a 
+		 non-temporal hint, bypassing the caches. Issue an _mm_sfence before 
+		 the written memory is consumed by another thread.
+		 */
+		void __vectorcall StoreStream(F32* p) const noexcept {
+			_mm_stream_ps(p, m_v);
+		}
+		void __vectorcall StoreStream(F32x4A& v) const noexcept {
+			_mm_stream_ps(v.data(), m_v);
+		}
+
 		//---------------------------------------------------------------------
 		// Member Methods
 		//---------------------------------------------------------------------
 
+		[[nodiscard]]
+		explicit operator F32x4() const noexcept {
+			F32x4 v;
+			_mm_storeu_ps(v.data(), m_v);
+			return v;
+		}
+
 		[[nodiscard]]
 		F32 __vectorcall X() const noexcept {
 			return _mm_cvtss_f32(m_v);
 		}
 		[[nodiscard]]
 		F32 __vectorcall Y() const noexcept {
-			return _mm_cvtss_f32(_mm_permute_ps(m_v, _MM_SHUFFLE(1, 1, 1, 1)));
+			return _mm_cvtss_f32(_mm_shuffle_ps(m_v, m_v, _MM_SHUFFLE(1, 1, 1, 1)));
 		}
 		[[nodiscard]]
 		F32 __vectorcall Z() const noexcept {
-			return _mm_cvtss_f32(_mm_permute_ps(m_v, _MM_SHUFFLE(2, 2, 2, 2)));
+			return _mm_cvtss_f32(_mm_shuffle_ps(m_v, m_v, _MM_SHUFFLE(2, 2, 2, 2)));
 		}
 		[[nodiscard]]
 		F32 __vectorcall W() const noexcept {
-			return _mm_cvtss_f32(_mm_permute_ps(m_v, _MM_SHUFFLE(3, 3, 3, 3)));
+			return _mm_cvtss_f32(_mm_shuffle_ps(m_v, m_v, _MM_SHUFFLE(3, 3, 3, 3)));
 		}
 
 		[[nodiscard]]
@@ -151,32 +303,981 @@ namespace maml {
 		}
 
 		[[nodiscard]]
-		bool __vectorcall operator==(const F32x4S& v) const {
-			const __m128i results = _mm_castps_si128(_mm_cmpeq_ps(m_v, v.m_v));
-			return (0xFFFF == _mm_movemask_epi8(results));
+		const Mask4 __vectorcall operator==(const F32x4S& v) const noexcept {
+			return _mm_cmpeq_ps(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const Mask4 __vectorcall operator!=(const F32x4S& v) const noexcept {
+			return _mm_cmpneq_ps(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const Mask4 __vectorcall operator<(const F32x4S& v) const noexcept {
+			return _mm_cmplt_ps(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const Mask4 __vectorcall operator<=(const F32x4S& v) const noexcept {
+			return _mm_cmple_ps(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const Mask4 __vectorcall operator>(const F32x4S& v) const noexcept {
+			return _mm_cmpgt_ps(m_v, v.m_v);
 		}
 		[[nodiscard]]
-		bool __vectorcall operator!=(const F32x4S& v) const {
-			return !(*this == v);
+		const Mask4 __vectorcall operator>=(const F32x4S& v) const noexcept {
+			return _mm_cmpge_ps(m_v, v.m_v);
 		}
 
 		__m128 m_v;
 	};
 
 	[[nodiscard]]
-	const F32x4S __vectorcall operator+(F32 a, const F32x4S& v) noexcept {
+	inline const F32x4S __vectorcall operator+(F32 a, const F32x4S& v) noexcept {
 		return _mm_add_ps(_mm_set_ps1(a), v.m_v);
 	}
 	[[nodiscard]]
-	const F32x4S __vectorcall operator-(F32 a, const F32x4S& v) noexcept {
+	inline const F32x4S __vectorcall operator-(F32 a, const F32x4S& v) noexcept {
 		return _mm_sub_ps(_mm_set_ps1(a), v.m_v);
 	}
 	[[nodiscard]]
-	const F32x4S __vectorcall operator*(F32 a, const F32x4S& v) noexcept {
+	inline const F32x4S __vectorcall operator*(F32 a, const F32x4S& v) noexcept {
 		return _mm_mul_ps(_mm_set_ps1(a), v.m_v);
 	}
 	[[nodiscard]]
-	const F32x4S __vectorcall operator/(F32 a, const F32x4S& v) noexcept {
+	inline const F32x4S __vectorcall operator/(F32 a, const F32x4S& v) noexcept {
 		return _mm_div_ps(_mm_set_ps1(a), v.m_v);
 	}
+
+	/**
+	 Selects component i from @a a if component i of @a m is set, and from 
+	 @a b otherwise.
+	 */
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Select(const Mask4& m, const F32x4S& a, const F32x4S& b) noexcept {
+		#if defined(__SSE4_1__) || defined(__AVX__)
+		return _mm_blendv_ps(b.m_v, a.m_v, m.m_v);
+		#else
+		return _mm_or_ps(_mm_and_ps(m.m_v, a.m_v), _mm_andnot_ps(m.m_v, b.m_v));
+		#endif
+	}
+
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Min(const F32x4S& a, const F32x4S& b) noexcept {
+		return _mm_min_ps(a.m_v, b.m_v);
+	}
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Max(const F32x4S& a, const F32x4S& b) noexcept {
+		return _mm_max_ps(a.m_v, b.m_v);
+	}
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Abs(const F32x4S& v) noexcept {
+		return _mm_andnot_ps(_mm_set_ps1(-0.0f), v.m_v);
+	}
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Sqrt(const F32x4S& v) noexcept {
+		return _mm_sqrt_ps(v.m_v);
+	}
+
+	/**
+	 Approximates the reciprocal square root of the given vector (relative 
+	 error <= 1.5 * 2^-12). An optional Newton-Raphson step refines this 
+	 approximation to nearly full single precision.
+	 */
+	template< bool NewtonRaphson = false >
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Rsqrt(const F32x4S& v) noexcept {
+		const F32x4S y = _mm_rsqrt_ps(v.m_v);
+		if constexpr (NewtonRaphson) {
+			// y' = y * (1.5 - 0.5 * v * y^2)
+			return y * (1.5f - (0.5f * v) * (y * y));
+		}
+		else {
+			return y;
+		}
+	}
+
+	/**
+	 Approximates the reciprocal of the given vector (relative error 
+	 <= 1.5 * 2^-12). An optional Newton-Raphson step refines this 
+	 approximation to nearly full single precision.
+	 */
+	template< bool NewtonRaphson = false >
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Rcp(const F32x4S& v) noexcept {
+		const F32x4S y = _mm_rcp_ps(v.m_v);
+		if constexpr (NewtonRaphson) {
+			// y' = y * (2 - v * y)
+			return y * (2.0f - v * y);
+		}
+		else {
+			return y;
+		}
+	}
+
+	/**
+	 Computes a * b + c (fused if FMA is enabled at compile time, see
+	 F32x8S for the fused operations at the AVX2 level).
+	 */
+	[[nodiscard]]
+	inline const F32x4S __vectorcall FMA(const F32x4S& a, const F32x4S& b, const F32x4S& c) noexcept {
+		#if defined(__FMA__) || defined(__AVX2__)
+		return _mm_fmadd_ps(a.m_v, b.m_v, c.m_v);
+		#else
+		return _mm_add_ps(_mm_mul_ps(a.m_v, b.m_v), c.m_v);
+		#endif
+	}
+
+	/**
+	 Computes a * b - c (fused if FMA is enabled at compile time, see
+	 F32x8S for the fused operations at the AVX2 level).
+	 */
+	[[nodiscard]]
+	inline const F32x4S __vectorcall FMS(const F32x4S& a, const F32x4S& b, const F32x4S& c) noexcept {
+		#if defined(__FMA__) || defined(__AVX2__)
+		return _mm_fmsub_ps(a.m_v, b.m_v, c.m_v);
+		#else
+		return _mm_sub_ps(_mm_mul_ps(a.m_v, b.m_v), c.m_v);
+		#endif
+	}
+
+	/**
+	 Computes the sum of all components of the given vector, broadcasted to 
+	 all components of the resulting vector.
+	 */
+	[[nodiscard]]
+	inline const F32x4S __vectorcall HorizontalSum(const F32x4S& v) noexcept {
+		// (x+y, y+x, z+w, w+z)
+		const __m128 v2 = _mm_add_ps(v.m_v, _mm_shuffle_ps(v.m_v, v.m_v, _MM_SHUFFLE(2, 3, 0, 1)));
+		// (x+y+z+w, ...)
+		return _mm_add_ps(v2, _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(1, 0, 3, 2)));
+	}
+
+	/**
+	 Computes the dot product of the given vectors, broadcasted to all 
+	 components of the resulting vector.
+	 */
+	[[nodiscard]]
+	inline const F32x4S __vectorcall Dot(const F32x4S& a, const F32x4S& b) noexcept {
+		return HorizontalSum(a * b);
+	}
+
+	template<>
+	struct IsScalarLike< F32x4S > : public std::true_type {};
+
+	// The 256-bit vectors require the AVX2 level (see target.hpp and
+	// GetSIMDLevel).
+	#ifdef MAML_HAS_AVX2_VECTORS
+
+	struct alignas(32) Mask8 {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		explicit Mask8(bool value = false) noexcept
+			: Mask8(_mm256_castsi256_ps(_mm256_set1_epi32(value ? -1 : 0))) {}
+		Mask8(__m256 v) noexcept
+			: m_v(v) {}
+
+		Mask8(const Mask8& v) noexcept = default;
+		Mask8(Mask8&& v) noexcept = default;
+		~Mask8() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		Mask8& operator=(const Mask8& v) noexcept = default;
+		Mask8& operator=(Mask8&& v) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		const Mask8 __vectorcall operator~() const noexcept {
+			return _mm256_xor_ps(m_v, Mask8(true).m_v);
+		}
+
+		[[nodiscard]]
+		const Mask8 __vectorcall operator&(const Mask8& v) const noexcept {
+			return _mm256_and_ps(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const Mask8 __vectorcall operator|(const Mask8& v) const noexcept {
+			return _mm256_or_ps(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const Mask8 __vectorcall operator^(const Mask8& v) const noexcept {
+			return _mm256_xor_ps(m_v, v.m_v);
+		}
+
+		Mask8& __vectorcall operator&=(const Mask8& v) noexcept {
+			m_v = _mm256_and_ps(m_v, v.m_v);
+			return *this;
+		}
+		Mask8& __vectorcall operator|=(const Mask8& v) noexcept {
+			m_v = _mm256_or_ps(m_v, v.m_v);
+			return *this;
+		}
+		Mask8& __vectorcall operator^=(const Mask8& v) noexcept {
+			m_v = _mm256_xor_ps(m_v, v.m_v);
+			return *this;
+		}
+
+		__m256 m_v;
+	};
+
+	/**
+	 Returns a bit mask with bit i set if component i of the given mask is set.
+	 */
+	[[nodiscard]]
+	inline U32 __vectorcall MoveMask(const Mask8& m) noexcept {
+		return static_cast< U32 >(_mm256_movemask_ps(m.m_v));
+	}
+	[[nodiscard]]
+	inline bool __vectorcall Any(const Mask8& m) noexcept {
+		return 0u != MoveMask(m);
+	}
+	[[nodiscard]]
+	inline bool __vectorcall All(const Mask8& m) noexcept {
+		return 0xFFu == MoveMask(m);
+	}
+	[[nodiscard]]
+	inline bool __vectorcall None(const Mask8& m) noexcept {
+		return 0u == MoveMask(m);
+	}
+
+	struct alignas(32) F32x8S {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		explicit F32x8S(F32 v = 0.0f) noexcept
+			: F32x8S(_mm256_set1_ps(v)) {}
+		F32x8S(F32 v0, F32 v1, F32 v2, F32 v3, 
+			   F32 v4, F32 v5, F32 v6, F32 v7) noexcept
+			: F32x8S(_mm256_set_ps(v7, v6, v5, v4, v3, v2, v1, v0)) {}
+		F32x8S(const F32x8& v) noexcept
+			: F32x8S(_mm256_loadu_ps(v.data())) {}
+		F32x8S(const F32x8A& v) noexcept
+			: F32x8S(_mm256_load_ps(v.data())) {}
+		F32x8S(const F32x4S& lo, const F32x4S& hi) noexcept
+			: F32x8S(_mm256_insertf128_ps(_mm256_castps128_ps256(lo.m_v), hi.m_v, 1)) {}
+		F32x8S(__m256 v) noexcept
+			: m_v(v) {}
+
+		F32x8S(const F32x8S& v) noexcept = default;
+		F32x8S(F32x8S&& v) noexcept = default;
+		~F32x8S() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		F32x8S& operator=(const F32x8S& v) noexcept = default;
+		F32x8S& operator=(F32x8S&& v) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Load and Store Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Loads a vector from the given 32-byte aligned memory.
+		 */
+		[[nodiscard]]
+		static const F32x8S __vectorcall Load(const F32* p) noexcept {
+			return _mm256_load_ps(p);
+		}
+		[[nodiscard]]
+		static const F32x8S __vectorcall Load(const F32x8A& v) noexcept {
+			return _mm256_load_ps(v.data());
+		}
+
+		/**
+		 Loads a vector from the given (possibly unaligned) memory.
+		 */
+		[[nodiscard]]
+		static const F32x8S __vectorcall LoadUnaligned(const F32* p) noexcept {
+			return _mm256_loadu_ps(p);
+		}
+		[[nodiscard]]
+		static const F32x8S __vectorcall LoadUnaligned(const F32x8& v) noexcept {
+			return _mm256_loadu_ps(v.data());
+		}
+
+		/**
+		 Stores this vector to the given 32-byte aligned memory.
+		 */
+		void __vectorcall Store(F32* p) const noexcept {
+			_mm256_store_ps(p, m_v);
+		}
+		void __vectorcall Store(F32x8A& v) const noexcept {
+			_mm256_store_ps(v.data(), m_v);
+		}
+
+		/**
+		 Stores this vector to the given (possibly unaligned) memory.
+		 */
+		void __vectorcall StoreUnaligned(F32* p) const noexcept {
+			_mm256_storeu_ps(p, m_v);
+		}
+		void __vectorcall StoreUnaligned(F32x8& v) const noexcept {
+			_mm256_storeu_ps(v.data(), m_v);
+		}
+
+		/**
+		 Stores this vector to the given 32-byte aligned memory with a 
+		 non-temporal hint, bypassing the caches. Issue an _mm_sfence before 
+		 the written memory is consumed by another thread.
+		 */
+		void __vectorcall StoreStream(F32* p) const noexcept {
+			_mm256_stream_ps(p, m_v);
+		}
+		void __vectorcall StoreStream(F32x8A& v) const noexcept {
+			_mm256_stream_ps(v.data(), m_v);
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		explicit operator F32x8() const noexcept {
+			F32x8 v;
+			_mm256_storeu_ps(v.data(), m_v);
+			return v;
+		}
+
+		[[nodiscard]]
+		const F32x4S __vectorcall Lo() const noexcept {
+			return _mm256_castps256_ps128(m_v);
+		}
+		[[nodiscard]]
+		const F32x4S __vectorcall Hi() const noexcept {
+			return _mm256_extractf128_ps(m_v, 1);
+		}
+
+		[[nodiscard]]
+		const F32x8S __vectorcall operator+() const noexcept {
+			return m_v;
+		}
+		[[nodiscard]]
+		const F32x8S __vectorcall operator-() const noexcept {
+			return _mm256_sub_ps(_mm256_setzero_ps(), m_v);
+		}
+
+		[[nodiscard]]
+		const F32x8S __vectorcall operator+(const F32x8S& v) const noexcept {
+			return _mm256_add_ps(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const F32x8S __vectorcall operator-(const F32x8S& v) const noexcept {
+			return _mm256_sub_ps(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const F32x8S __vectorcall operator*(const F32x8S& v) const noexcept {
+			return _mm256_mul_ps(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const F32x8S __vectorcall operator/(const F32x8S& v) const noexcept {
+			return _mm256_div_ps(m_v, v.m_v);
+		}
+
+		[[nodiscard]]
+		const F32x8S __vectorcall operator+(F32 a) const noexcept {
+			return _mm256_add_ps(m_v, _mm256_set1_ps(a));
+		}
+		[[nodiscard]]
+		const F32x8S __vectorcall operator-(F32 a) const noexcept {
+			return _mm256_sub_ps(m_v, _mm256_set1_ps(a));
+		}
+		[[nodiscard]]
+		const F32x8S __vectorcall operator*(F32 a) const noexcept {
+			return _mm256_mul_ps(m_v, _mm256_set1_ps(a));
+		}
+		[[nodiscard]]
+		const F32x8S __vectorcall operator/(F32 a) const noexcept {
+			return _mm256_div_ps(m_v, _mm256_set1_ps(a));
+		}
+
+		F32x8S& __vectorcall operator+=(const F32x8S& v) noexcept {
+			m_v = _mm256_add_ps(m_v, v.m_v);
+			return *this;
+		}
+		F32x8S& __vectorcall operator-=(const F32x8S& v) noexcept {
+			m_v = _mm256_sub_ps(m_v, v.m_v);
+			return *this;
+		}
+		F32x8S& __vectorcall operator*=(const F32x8S& v) noexcept {
+			m_v = _mm256_mul_ps(m_v, v.m_v);
+			return *this;
+		}
+		F32x8S& __vectorcall operator/=(const F32x8S& v) noexcept {
+			m_v = _mm256_div_ps(m_v, v.m_v);
+			return *this;
+		}
+
+		F32x8S& __vectorcall operator+=(F32 a) noexcept {
+			m_v = _mm256_add_ps(m_v, _mm256_set1_ps(a));
+			return *this;
+		}
+		F32x8S& __vectorcall operator-=(F32 a) noexcept {
+			m_v = _mm256_sub_ps(m_v, _mm256_set1_ps(a));
+			return *this;
+		}
+		F32x8S& __vectorcall operator*=(F32 a) noexcept {
+			m_v = _mm256_mul_ps(m_v, _mm256_set1_ps(a));
+			return *this;
+		}
+		F32x8S& __vectorcall operator/=(F32 a) noexcept {
+			m_v = _mm256_div_ps(m_v, _mm256_set1_ps(a));
+			return *this;
+		}
+
+		[[nodiscard]]
+		const Mask8 __vectorcall operator==(const F32x8S& v) const noexcept {
+			return _mm256_cmp_ps(m_v, v.m_v, _CMP_EQ_OQ);
+		}
+		[[nodiscard]]
+		const Mask8 __vectorcall operator!=(const F32x8S& v) const noexcept {
+			return _mm256_cmp_ps(m_v, v.m_v, _CMP_NEQ_UQ);
+		}
+		[[nodiscard]]
+		const Mask8 __vectorcall operator<(const F32x8S& v) const noexcept {
+			return _mm256_cmp_ps(m_v, v.m_v, _CMP_LT_OQ);
+		}
+		[[nodiscard]]
+		const Mask8 __vectorcall operator<=(const F32x8S& v) const noexcept {
+			return _mm256_cmp_ps(m_v, v.m_v, _CMP_LE_OQ);
+		}
+		[[nodiscard]]
+		const Mask8 __vectorcall operator>(const F32x8S& v) const noexcept {
+			return _mm256_cmp_ps(m_v, v.m_v, _CMP_GT_OQ);
+		}
+		[[nodiscard]]
+		const Mask8 __vectorcall operator>=(const F32x8S& v) const noexcept {
+			return _mm256_cmp_ps(m_v, v.m_v, _CMP_GE_OQ);
+		}
+
+		__m256 m_v;
+	};
+
+	[[nodiscard]]
+	inline const F32x8S __vectorcall operator+(F32 a, const F32x8S& v) noexcept {
+		return _mm256_add_ps(_mm256_set1_ps(a), v.m_v);
+	}
+	[[nodiscard]]
+	inline const F32x8S __vectorcall operator-(F32 a, const F32x8S& v) noexcept {
+		return _mm256_sub_ps(_mm256_set1_ps(a), v.m_v);
+	}
+	[[nodiscard]]
+	inline const F32x8S __vectorcall operator*(F32 a, const F32x8S& v) noexcept {
+		return _mm256_mul_ps(_mm256_set1_ps(a), v.m_v);
+	}
+	[[nodiscard]]
+	inline const F32x8S __vectorcall operator/(F32 a, const F32x8S& v) noexcept {
+		return _mm256_div_ps(_mm256_set1_ps(a), v.m_v);
+	}
+
+	/**
+	 Selects component i from @a a if component i of @a m is set, and from 
+	 @a b otherwise.
+	 */
+	[[nodiscard]]
+	inline const F32x8S __vectorcall Select(const Mask8& m, const F32x8S& a, const F32x8S& b) noexcept {
+		return _mm256_blendv_ps(b.m_v, a.m_v, m.m_v);
+	}
+
+	[[nodiscard]]
+	inline const F32x8S __vectorcall Min(const F32x8S& a, const F32x8S& b) noexcept {
+		return _mm256_min_ps(a.m_v, b.m_v);
+	}
+	[[nodiscard]]
+	inline const F32x8S __vectorcall Max(const F32x8S& a, const F32x8S& b) noexcept {
+		return _mm256_max_ps(a.m_v, b.m_v);
+	}
+	[[nodiscard]]
+	inline const F32x8S __vectorcall Abs(const F32x8S& v) noexcept {
+		return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), v.m_v);
+	}
+	[[nodiscard]]
+	inline const F32x8S __vectorcall Sqrt(const F32x8S& v) noexcept {
+		return _mm256_sqrt_ps(v.m_v);
+	}
+
+	/**
+	 Approximates the reciprocal square root of the given vector (relative 
+	 error <= 1.5 * 2^-12). An optional Newton-Raphson step refines this 
+	 approximation to nearly full single precision.
+	 */
+	template< bool NewtonRaphson = false >
+	[[nodiscard]]
+	inline const F32x8S __vectorcall Rsqrt(const F32x8S& v) noexcept {
+		const F32x8S y = _mm256_rsqrt_ps(v.m_v);
+		if constexpr (NewtonRaphson) {
+			// y' = y * (1.5 - 0.5 * v * y^2)
+			return y * (1.5f - (0.5f * v) * (y * y));
+		}
+		else {
+			return y;
+		}
+	}
+
+	/**
+	 Approximates the reciprocal of the given vector (relative error 
+	 <= 1.5 * 2^-12). An optional Newton-Raphson step refines this 
+	 approximation to nearly full single precision.
+	 */
+	template< bool NewtonRaphson = false >
+	[[nodiscard]]
+	inline const F32x8S __vectorcall Rcp(const F32x8S& v) noexcept {
+		const F32x8S y = _mm256_rcp_ps(v.m_v);
+		if constexpr (NewtonRaphson) {
+			// y' = y * (2 - v * y)
+			return y * (2.0f - v * y);
+		}
+		else {
+			return y;
+		}
+	}
+
+	/**
+	 Computes a * b + c (fused).
+	 */
+	[[nodiscard]]
+	inline const F32x8S __vectorcall FMA(const F32x8S& a, const F32x8S& b, const F32x8S& c) noexcept {
+		return _mm256_fmadd_ps(a.m_v, b.m_v, c.m_v);
+	}
+
+	/**
+	 Computes a * b - c (fused).
+	 */
+	[[nodiscard]]
+	inline const F32x8S __vectorcall FMS(const F32x8S& a, const F32x8S& b, const F32x8S& c) noexcept {
+		return _mm256_fmsub_ps(a.m_v, b.m_v, c.m_v);
+	}
+
+	/**
+	 Computes the sum of all components of the given vector, broadcasted to 
+	 all components of the resulting vector.
+	 */
+	[[nodiscard]]
+	inline const F32x8S __vectorcall HorizontalSum(const F32x8S& v) noexcept {
+		// Add both 128-bit halves: (v0+v4, v1+v5, v2+v6, v3+v7, ...)
+		const __m256 v4 = _mm256_add_ps(v.m_v, _mm256_permute2f128_ps(v.m_v, v.m_v, 0x01));
+		const __m256 v2 = _mm256_add_ps(v4, _mm256_shuffle_ps(v4, v4, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm256_add_ps(v2, _mm256_shuffle_ps(v2, v2, _MM_SHUFFLE(1, 0, 3, 2)));
+	}
+
+	/**
+	 Computes the dot product of the given vectors, broadcasted to all 
+	 components of the resulting vector.
+	 */
+	[[nodiscard]]
+	inline const F32x8S __vectorcall Dot(const F32x8S& a, const F32x8S& b) noexcept {
+		return HorizontalSum(a * b);
+	}
+
+	template<>
+	struct IsScalarLike< F32x8S > : public std::true_type {};
+
+	struct alignas(32) Mask4d {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		explicit Mask4d(bool value = false) noexcept
+			: Mask4d(_mm256_castsi256_pd(_mm256_set1_epi64x(value ? -1 : 0))) {}
+		Mask4d(__m256d v) noexcept
+			: m_v(v) {}
+
+		Mask4d(const Mask4d& v) noexcept = default;
+		Mask4d(Mask4d&& v) noexcept = default;
+		~Mask4d() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		Mask4d& operator=(const Mask4d& v) noexcept = default;
+		Mask4d& operator=(Mask4d&& v) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		const Mask4d __vectorcall operator~() const noexcept {
+			return _mm256_xor_pd(m_v, Mask4d(true).m_v);
+		}
+
+		[[nodiscard]]
+		const Mask4d __vectorcall operator&(const Mask4d& v) const noexcept {
+			return _mm256_and_pd(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const Mask4d __vectorcall operator|(const Mask4d& v) const noexcept {
+			return _mm256_or_pd(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const Mask4d __vectorcall operator^(const Mask4d& v) const noexcept {
+			return _mm256_xor_pd(m_v, v.m_v);
+		}
+
+		Mask4d& __vectorcall operator&=(const Mask4d& v) noexcept {
+			m_v = _mm256_and_pd(m_v, v.m_v);
+			return *this;
+		}
+		Mask4d& __vectorcall operator|=(const Mask4d& v) noexcept {
+			m_v = _mm256_or_pd(m_v, v.m_v);
+			return *this;
+		}
+		Mask4d& __vectorcall operator^=(const Mask4d& v) noexcept {
+			m_v = _mm256_xor_pd(m_v, v.m_v);
+			return *this;
+		}
+
+		__m256d m_v;
+	};
+
+	/**
+	 Returns a bit mask with bit i set if component i of the given mask is set.
+	 */
+	[[nodiscard]]
+	inline U32 __vectorcall MoveMask(const Mask4d& m) noexcept {
+		return static_cast< U32 >(_mm256_movemask_pd(m.m_v));
+	}
+	[[nodiscard]]
+	inline bool __vectorcall Any(const Mask4d& m) noexcept {
+		return 0u != MoveMask(m);
+	}
+	[[nodiscard]]
+	inline bool __vectorcall All(const Mask4d& m) noexcept {
+		return 0xFu == MoveMask(m);
+	}
+	[[nodiscard]]
+	inline bool __vectorcall None(const Mask4d& m) noexcept {
+		return 0u == MoveMask(m);
+	}
+
+	struct alignas(32) F64x4S {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		explicit F64x4S(F64 xyzw = 0.0) noexcept
+			: F64x4S(_mm256_set1_pd(xyzw)) {}
+		F64x4S(F64 x, F64 y, F64 z, F64 w) noexcept
+			: F64x4S(_mm256_set_pd(w, z, y, x)) {}
+		F64x4S(const F64x4& v) noexcept
+			: F64x4S(_mm256_loadu_pd(v.data())) {}
+		F64x4S(const F64x4A& v) noexcept
+			: F64x4S(_mm256_load_pd(v.data())) {}
+		explicit F64x4S(const F32x4S& v) noexcept
+			: F64x4S(_mm256_cvtps_pd(v.m_v)) {}
+		F64x4S(__m256d v) noexcept
+			: m_v(v) {}
+
+		F64x4S(const F64x4S& v) noexcept = default;
+		F64x4S(F64x4S&& v) noexcept = default;
+		~F64x4S() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		F64x4S& operator=(const F64x4S& v) noexcept = default;
+		F64x4S& operator=(F64x4S&& v) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Load and Store Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Loads a vector from the given 32-byte aligned memory.
+		 */
+		[[nodiscard]]
+		static const F64x4S __vectorcall Load(const F64* p) noexcept {
+			return _mm256_load_pd(p);
+		}
+		[[nodiscard]]
+		static const F64x4S __vectorcall Load(const F64x4A& v) noexcept {
+			return _mm256_load_pd(v.data());
+		}
+
+		/**
+		 Loads a vector from the given (possibly unaligned) memory.
+		 */
+		[[nodiscard]]
+		static const F64x4S __vectorcall LoadUnaligned(const F64* p) noexcept {
+			return _mm256_loadu_pd(p);
+		}
+		[[nodiscard]]
+		static const F64x4S __vectorcall LoadUnaligned(const F64x4& v) noexcept {
+			return _mm256_loadu_pd(v.data());
+		}
+
+		/**
+		 Stores this vector to the given 32-byte aligned memory.
+		 */
+		void __vectorcall Store(F64* p) const noexcept {
+			_mm256_store_pd(p, m_v);
+		}
+		void __vectorcall Store(F64x4A& v) const noexcept {
+			_mm256_store_pd(v.data(), m_v);
+		}
+
+		/**
+		 Stores this vector to the given (possibly unaligned) memory.
+		 */
+		void __vectorcall StoreUnaligned(F64* p) const noexcept {
+			_mm256_storeu_pd(p, m_v);
+		}
+		void __vectorcall StoreUnaligned(F64x4& v) const noexcept {
+			_mm256_storeu_pd(v.data(), m_v);
+		}
+
+		/**
+		 Stores this vector to the given 32-byte aligned memory with a 
+		 non-temporal hint, bypassing the caches. Issue an _mm_sfence before 
+		 the written memory is consumed by another thread.
+		 */
+		void __vectorcall StoreStream(F64* p) const noexcept {
+			_mm256_stream_pd(p, m_v);
+		}
+		void __vectorcall StoreStream(F64x4A& v) const noexcept {
+			_mm256_stream_pd(v.data(), m_v);
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		explicit operator F64x4() const noexcept {
+			F64x4 v;
+			_mm256_storeu_pd(v.data(), m_v);
+			return v;
+		}
+
+		[[nodiscard]]
+		explicit operator F32x4S() const noexcept {
+			return _mm256_cvtpd_ps(m_v);
+		}
+
+		[[nodiscard]]
+		F64 __vectorcall X() const noexcept {
+			return _mm_cvtsd_f64(_mm256_castpd256_pd128(m_v));
+		}
+		[[nodiscard]]
+		F64 __vectorcall Y() const noexcept {
+			const __m128d xy = _mm256_castpd256_pd128(m_v);
+			return _mm_cvtsd_f64(_mm_unpackhi_pd(xy, xy));
+		}
+		[[nodiscard]]
+		F64 __vectorcall Z() const noexcept {
+			return _mm_cvtsd_f64(_mm256_extractf128_pd(m_v, 1));
+		}
+		[[nodiscard]]
+		F64 __vectorcall W() const noexcept {
+			const __m128d zw = _mm256_extractf128_pd(m_v, 1);
+			return _mm_cvtsd_f64(_mm_unpackhi_pd(zw, zw));
+		}
+
+		[[nodiscard]]
+		const F64x4S __vectorcall operator+() const noexcept {
+			return m_v;
+		}
+		[[nodiscard]]
+		const F64x4S __vectorcall operator-() const noexcept {
+			return _mm256_sub_pd(_mm256_setzero_pd(), m_v);
+		}
+
+		[[nodiscard]]
+		const F64x4S __vectorcall operator+(const F64x4S& v) const noexcept {
+			return _mm256_add_pd(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const F64x4S __vectorcall operator-(const F64x4S& v) const noexcept {
+			return _mm256_sub_pd(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const F64x4S __vectorcall operator*(const F64x4S& v) const noexcept {
+			return _mm256_mul_pd(m_v, v.m_v);
+		}
+		[[nodiscard]]
+		const F64x4S __vectorcall operator/(const F64x4S& v) const noexcept {
+			return _mm256_div_pd(m_v, v.m_v);
+		}
+
+		[[nodiscard]]
+		const F64x4S __vectorcall operator+(F64 a) const noexcept {
+			return _mm256_add_pd(m_v, _mm256_set1_pd(a));
+		}
+		[[nodiscard]]
+		const F64x4S __vectorcall operator-(F64 a) const noexcept {
+			return _mm256_sub_pd(m_v, _mm256_set1_pd(a));
+		}
+		[[nodiscard]]
+		const F64x4S __vectorcall operator*(F64 a) const noexcept {
+			return _mm256_mul_pd(m_v, _mm256_set1_pd(a));
+		}
+		[[nodiscard]]
+		const F64x4S __vectorcall operator/(F64 a) const noexcept {
+			return _mm256_div_pd(m_v, _mm256_set1_pd(a));
+		}
+
+		F64x4S& __vectorcall operator+=(const F64x4S& v) noexcept {
+			m_v = _mm256_add_pd(m_v, v.m_v);
+			return *this;
+		}
+		F64x4S& __vectorcall operator-=(const F64x4S& v) noexcept {
+			m_v = _mm256_sub_pd(m_v, v.m_v);
+			return *this;
+		}
+		F64x4S& __vectorcall operator*=(const F64x4S& v) noexcept {
+			m_v = _mm256_mul_pd(m_v, v.m_v);
+			return *this;
+		}
+		F64x4S& __vectorcall operator/=(const F64x4S& v) noexcept {
+			m_v = _mm256_div_pd(m_v, v.m_v);
+			return *this;
+		}
+
+		F64x4S& __vectorcall operator+=(F64 a) noexcept {
+			m_v = _mm256_add_pd(m_v, _mm256_set1_pd(a));
+			return *this;
+		}
+		F64x4S& __vectorcall operator-=(F64 a) noexcept {
+			m_v = _mm256_sub_pd(m_v, _mm256_set1_pd(a));
+			return *this;
+		}
+		F64x4S& __vectorcall operator*=(F64 a) noexcept {
+			m_v = _mm256_mul_pd(m_v, _mm256_set1_pd(a));
+			return *this;
+		}
+		F64x4S& __vectorcall operator/=(F64 a) noexcept {
+			m_v = _mm256_div_pd(m_v, _mm256_set1_pd(a));
+			return *this;
+		}
+
+		[[nodiscard]]
+		const Mask4d __vectorcall operator==(const F64x4S& v) const noexcept {
+			return _mm256_cmp_pd(m_v, v.m_v, _CMP_EQ_OQ);
+		}
+		[[nodiscard]]
+		const Mask4d __vectorcall operator!=(const F64x4S& v) const noexcept {
+			return _mm256_cmp_pd(m_v, v.m_v, _CMP_NEQ_UQ);
+		}
+		[[nodiscard]]
+		const Mask4d __vectorcall operator<(const F64x4S& v) const noexcept {
+			return _mm256_cmp_pd(m_v, v.m_v, _CMP_LT_OQ);
+		}
+		[[nodiscard]]
+		const Mask4d __vectorcall operator<=(const F64x4S& v) const noexcept {
+			return _mm256_cmp_pd(m_v, v.m_v, _CMP_LE_OQ);
+		}
+		[[nodiscard]]
+		const Mask4d __vectorcall operator>(const F64x4S& v) const noexcept {
+			return _mm256_cmp_pd(m_v, v.m_v, _CMP_GT_OQ);
+		}
+		[[nodiscard]]
+		const Mask4d __vectorcall operator>=(const F64x4S& v) const noexcept {
+			return _mm256_cmp_pd(m_v, v.m_v, _CMP_GE_OQ);
+		}
+
+		__m256d m_v;
+	};
+
+	[[nodiscard]]
+	inline const F64x4S __vectorcall operator+(F64 a, const F64x4S& v) noexcept {
+		return _mm256_add_pd(_mm256_set1_pd(a), v.m_v);
+	}
+	[[nodiscard]]
+	inline const F64x4S __vectorcall operator-(F64 a, const F64x4S& v) noexcept {
+		return _mm256_sub_pd(_mm256_set1_pd(a), v.m_v);
+	}
+	[[nodiscard]]
+	inline const F64x4S __vectorcall operator*(F64 a, const F64x4S& v) noexcept {
+		return _mm256_mul_pd(_mm256_set1_pd(a), v.m_v);
+	}
+	[[nodiscard]]
+	inline const F64x4S __vectorcall operator/(F64 a, const F64x4S& v) noexcept {
+		return _mm256_div_pd(_mm256_set1_pd(a), v.m_v);
+	}
+
+	/**
+	 Selects component i from @a a if component i of @a m is set, and from 
+	 @a b otherwise.
+	 */
+	[[nodiscard]]
+	inline const F64x4S __vectorcall Select(const Mask4d& m, const F64x4S& a, const F64x4S& b) noexcept {
+		return _mm256_blendv_pd(b.m_v, a.m_v, m.m_v);
+	}
+
+	[[nodiscard]]
+	inline const F64x4S __vectorcall Min(const F64x4S& a, const F64x4S& b) noexcept {
+		return _mm256_min_pd(a.m_v, b.m_v);
+	}
+	[[nodiscard]]
+	inline const F64x4S __vectorcall Max(const F64x4S& a, const F64x4S& b) noexcept {
+		return _mm256_max_pd(a.m_v, b.m_v);
+	}
+	[[nodiscard]]
+	inline const F64x4S __vectorcall Abs(const F64x4S& v) noexcept {
+		return _mm256_andnot_pd(_mm256_set1_pd(-0.0), v.m_v);
+	}
+	[[nodiscard]]
+	inline const F64x4S __vectorcall Sqrt(const F64x4S& v) noexcept {
+		return _mm256_sqrt_pd(v.m_v);
+	}
+
+	/**
+	 Computes a * b + c (fused).
+	 */
+	[[nodiscard]]
+	inline const F64x4S __vectorcall FMA(const F64x4S& a, const F64x4S& b, const F64x4S& c) noexcept {
+		return _mm256_fmadd_pd(a.m_v, b.m_v, c.m_v);
+	}
+
+	/**
+	 Computes a * b - c (fused).
+	 */
+	[[nodiscard]]
+	inline const F64x4S __vectorcall FMS(const F64x4S& a, const F64x4S& b, const F64x4S& c) noexcept {
+		return _mm256_fmsub_pd(a.m_v, b.m_v, c.m_v);
+	}
+
+	/**
+	 Computes the sum of all components of the given vector, broadcasted to 
+	 all components of the resulting vector.
+	 */
+	[[nodiscard]]
+	inline const F64x4S __vectorcall HorizontalSum(const F64x4S& v) noexcept {
+		// Add both 128-bit halves: (x+z, y+w, z+x, w+y)
+		const __m256d v2 = _mm256_add_pd(v.m_v, _mm256_permute2f128_pd(v.m_v, v.m_v, 0x01));
+		return _mm256_add_pd(v2, _mm256_shuffle_pd(v2, v2, 0x5));
+	}
+
+	/**
+	 Computes the dot product of the given vectors, broadcasted to all 
+	 components of the resulting vector.
+	 */
+	[[nodiscard]]
+	inline const F64x4S __vectorcall Dot(const F64x4S& a, const F64x4S& b) noexcept {
+		return HorizontalSum(a * b);
+	}
+
+	#endif
 }
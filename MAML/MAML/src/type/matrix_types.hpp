@@ -0,0 +1,47 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\vector_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace maml {
+
+	//-------------------------------------------------------------------------
+	// Floating Point Matrices
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A 4x4 matrix type for floating points with width of exactly 32 bits. 
+	 The matrix is stored in column-major order (i.e. an array of columns).
+	 */
+	using F32x4x4 = Array< F32x4, 4u >;
+
+	/**
+	 A 4x4 matrix type for floating points with width of exactly 32 bits with 
+	 a 16-byte alignment. The matrix is stored in column-major order (i.e. an 
+	 array of columns).
+	 */
+	using F32x4x4A = Array< F32x4A, 4u, 16u >;
+
+	static_assert(16u * sizeof(F32) == sizeof(F32x4x4));
+	static_assert(64u == sizeof(F32x4x4A));
+
+	/**
+	 A 4x4 matrix type for floating points with width of exactly 64 bits. 
+	 The matrix is stored in column-major order (i.e. an array of columns).
+	 */
+	using F64x4x4 = Array< F64x4, 4u >;
+
+	static_assert(16u * sizeof(F64) == sizeof(F64x4x4));
+
+	#pragma endregion
+}
@@ -7,6 +7,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
 
 #pragma endregion
 
@@ -148,4 +149,20 @@ namespace maml {
 	static_assert(8u <= sizeof(FU64));
 
 	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Scalar-like Types
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Checks whether the given type behaves like a floating point scalar under 
+	 the arithmetic operators. Besides the floating point types, this holds 
+	 for the SIMD packets of floating points (see simd\vector.hpp), whose 
+	 comparison operators return lane masks instead of bools.
+	 */
+	template< typename T >
+	struct IsScalarLike : public std::is_floating_point< T > {};
+
+	#pragma endregion
 }
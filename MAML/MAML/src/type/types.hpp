@@ -8,5 +8,7 @@
 // Scalar types.
 // Vector types.
 #include "type\vector_types.hpp"
+// Matrix types.
+#include "type\matrix_types.hpp"
 
 #pragma endregion
\ No newline at end of file
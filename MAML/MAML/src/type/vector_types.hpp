@@ -61,6 +61,21 @@ namespace maml {
 	static_assert(16u == sizeof(F32x3A));
 	static_assert(16u == sizeof(F32x4A));
 
+	/**
+	 A 8x1 vector type for floating points with width of exactly 32 bits.
+	 */
+	using F32x8 = Array< F32, 8u >;
+
+	static_assert(8u * sizeof(F32) == sizeof(F32x8));
+
+	/**
+	 A 8x1 vector type for floating points with width of exactly 32 bits with 
+	 a 32-byte alignment.
+	 */
+	using F32x8A = Array< F32, 8u, 32u >;
+
+	static_assert(32u == sizeof(F32x8A));
+
 	/**
 	 A 2x1 vector type for floating points with width of exactly 64 bits.
 	 */
@@ -80,6 +95,14 @@ namespace maml {
 	static_assert(3u * sizeof(F64) == sizeof(F64x3));
 	static_assert(4u * sizeof(F64) == sizeof(F64x4));
 
+	/**
+	 A 4x1 vector type for floating points with width of exactly 64 bits with 
+	 a 32-byte alignment.
+	 */
+	using F64x4A = Array< F64, 4u, 32u >;
+
+	static_assert(32u == sizeof(F64x4A));
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -296,6 +319,13 @@ namespace maml {
 	static_assert(3u * sizeof(U16) == sizeof(U16x3));
 	static_assert(4u * sizeof(U16) == sizeof(U16x4));
 
+	/**
+	 A 8x1 vector type for unsigned integers with width of exactly 16 bits.
+	 */
+	using U16x8 = Array< U16, 8u >;
+
+	static_assert(8u * sizeof(U16) == sizeof(U16x8));
+
 	/**
 	 A 2x1 vector type for unsigned integers with width of exactly 32 bits.
 	 */